@@ -1,5 +1,7 @@
 #include "CommunicateMesh.hpp"
-#include <map>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <vector>
 #include "Communication.hpp"
 #include "com/SharedPointer.hpp"
@@ -12,296 +14,213 @@ namespace precice
 {
 namespace com
 {
-CommunicateMesh::CommunicateMesh(
-    com::PtrCommunication communication)
-    : _communication(communication)
-{
-}
 
-void CommunicateMesh::sendMesh(
-    const mesh::Mesh &mesh,
-    int               rankReceiver)
+namespace
 {
-  TRACE(mesh.getName(), rankReceiver);
-  int dim = mesh.getDimensions();
-
-  int numberOfVertices = mesh.vertices().size();
-  _communication->send(numberOfVertices, rankReceiver);
-  if (not mesh.vertices().empty()) {
-    std::vector<double> coords(numberOfVertices * dim);
-    std::vector<int> globalIDs(numberOfVertices);
-    for (int i = 0; i < numberOfVertices; i++) {
-      for (int d = 0; d < dim; d++) {
-        coords[i * dim + d] = mesh.vertices()[i].getCoords()[d];
-      }
-      globalIDs[i] = mesh.vertices()[i].getGlobalIndex();
-    }
-    _communication->send(coords, rankReceiver);
-    _communication->send(globalIDs, rankReceiver);
-  }
 
-  int numberOfEdges = mesh.edges().size();
-  _communication->send(numberOfEdges, rankReceiver);
-  if (not mesh.edges().empty()) {
-    //we need to send the vertexIDs first such that the right edges can be created later
-    //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-    std::vector<int> vertexIDs(numberOfVertices);
-    for (int i = 0; i < numberOfVertices; i++) {
-      vertexIDs[i] = mesh.vertices()[i].getID();
-    }
-    _communication->send(vertexIDs, rankReceiver);
+/// Number of integers in front of the coordinates of a mesh message.
+const int HEADER_SIZE = 4;
 
-    std::vector<int> edgeIDs(numberOfEdges * 2);
-    for (int i = 0; i < numberOfEdges; i++) {
-      edgeIDs[i * 2]     = mesh.edges()[i].vertex(0).getID();
-      edgeIDs[i * 2 + 1] = mesh.edges()[i].vertex(1).getID();
-    }
-    _communication->send(edgeIDs, rankReceiver);
+/// Appends the integer zigzag and LEB128 encoded, i.e. with one byte for values in [-64, 63].
+void appendVarint(std::vector<unsigned char> &bytes, int value)
+{
+  std::uint32_t zigzag = (static_cast<std::uint32_t>(value) << 1) ^ static_cast<std::uint32_t>(value >> 31);
+  while (zigzag >= 0x80) {
+    bytes.push_back(static_cast<unsigned char>(zigzag | 0x80));
+    zigzag >>= 7;
   }
+  bytes.push_back(static_cast<unsigned char>(zigzag));
+}
 
-  if (dim == 3) {
-    int numberOfTriangles = mesh.triangles().size();
-    _communication->send(numberOfTriangles, rankReceiver);
-    if (not mesh.triangles().empty()) {
-      //we need to send the edgeIDs first such that the right edges can be created later
-      //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-      std::vector<int> edgeIDs(numberOfEdges);
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeIDs[i] = mesh.edges()[i].getID();
-      }
-      _communication->send(edgeIDs, rankReceiver);
-
-      std::vector<int> triangleIDs(numberOfTriangles * 3);
-      for (int i = 0; i < numberOfTriangles; i++) {
-        triangleIDs[i * 3]     = mesh.triangles()[i].edge(0).getID();
-        triangleIDs[i * 3 + 1] = mesh.triangles()[i].edge(1).getID();
-        triangleIDs[i * 3 + 2] = mesh.triangles()[i].edge(2).getID();
-      }
-      _communication->send(triangleIDs, rankReceiver);
-    }
+/// Reads an integer appended by appendVarint() and advances the position.
+int readVarint(const unsigned char *&position)
+{
+  std::uint32_t zigzag = 0;
+  int           shift  = 0;
+  while (*position & 0x80) {
+    zigzag |= static_cast<std::uint32_t>(*position++ & 0x7f) << shift;
+    shift += 7;
   }
+  zigzag |= static_cast<std::uint32_t>(*position++) << shift;
+  return static_cast<int>(zigzag >> 1) ^ -static_cast<int>(zigzag & 1);
 }
 
-void CommunicateMesh::receiveMesh(
-    mesh::Mesh &mesh,
-    int         rankSender)
+/// Appends the differences of subsequent integers varint encoded.
+void appendDeltas(std::vector<unsigned char> &bytes, std::vector<int> const &values)
 {
-  TRACE(mesh.getName(), rankSender);
-  int dim = mesh.getDimensions();
+  int previous = 0;
+  for (int value : values) {
+    appendVarint(bytes, value - previous);
+    previous = value;
+  }
+}
 
-  std::vector<mesh::Vertex *>   vertices;
-  std::map<int, mesh::Vertex *> vertexMap;
-  int                           numberOfVertices = 0;
-  _communication->receive(numberOfVertices, rankSender);
-  DEBUG("Number of vertices to receive: " << numberOfVertices);
+} // namespace
 
-  if (numberOfVertices > 0) {
-    std::vector<double> vertexCoords;
-    std::vector<int> globalIDs;
-    _communication->receive(vertexCoords, rankSender);
-    _communication->receive(globalIDs, rankSender);
-    for (int i = 0; i < numberOfVertices; i++) {
-      Eigen::VectorXd coords(dim);
-      for (int d = 0; d < dim; d++) {
-        coords[d] = vertexCoords[i * dim + d];
-      }
-      mesh::Vertex &v = mesh.createVertex(coords);
-      assertion(v.getID() >= 0, v.getID());
-      v.setGlobalIndex(globalIDs[i]);
-      vertices.push_back(&v);
+std::vector<int> CommunicateMesh::packMesh(const mesh::Mesh &mesh)
+{
+  int dim               = mesh.getDimensions();
+  int numberOfVertices  = mesh.vertices().size();
+  int numberOfEdges     = mesh.edges().size();
+  int numberOfTriangles = mesh.triangles().size();
+
+  // Positions of the vertices and edges, such that the connectivity is sent with zero-based local indices.
+  std::vector<int> vertexPositions;
+  for (int i = 0; i < numberOfVertices; i++) {
+    int id = mesh.vertices()[i].getID();
+    if (id >= static_cast<int>(vertexPositions.size())) {
+      vertexPositions.resize(id + 1, -1);
+    }
+    vertexPositions[id] = i;
+  }
+  std::vector<int> edgePositions;
+  for (int i = 0; i < numberOfEdges; i++) {
+    int id = mesh.edges()[i].getID();
+    if (id >= static_cast<int>(edgePositions.size())) {
+      edgePositions.resize(id + 1, -1);
     }
+    edgePositions[id] = i;
   }
 
-  int                       numberOfEdges = 0;
-  std::vector<mesh::Edge *> edges;
-  _communication->receive(numberOfEdges, rankSender);
-  DEBUG("Number of edges to receive: " << numberOfEdges);
-  if (numberOfEdges > 0) {
-    std::vector<int> vertexIDs;
-    _communication->receive(vertexIDs, rankSender);
-    for (int i = 0; i < numberOfVertices; i++) {
-      vertexMap[vertexIDs[i]] = vertices[i];
-    }
+  std::vector<int> indices;
+  indices.reserve(std::max(numberOfVertices, std::max(2 * numberOfEdges, 3 * numberOfTriangles)));
+  std::vector<unsigned char> connectivity;
+  connectivity.reserve(numberOfVertices + 2 * numberOfEdges + 3 * numberOfTriangles);
 
-    std::vector<int> edgeIDs;
-    _communication->receive(edgeIDs, rankSender);
-    for (int i = 0; i < numberOfEdges; i++) {
-      assertion(vertexMap.find(edgeIDs[i * 2]) != vertexMap.end());
-      assertion(vertexMap.find(edgeIDs[i * 2 + 1]) != vertexMap.end());
-      assertion(edgeIDs[i * 2] != edgeIDs[i * 2 + 1]);
-      mesh::Edge &e = mesh.createEdge(*vertexMap[edgeIDs[i * 2]], *vertexMap[edgeIDs[i * 2 + 1]]);
-      edges.push_back(&e);
-    }
+  for (auto const &vertex : mesh.vertices()) {
+    indices.push_back(vertex.getGlobalIndex());
   }
+  appendDeltas(connectivity, indices);
 
-  if (dim == 3) {
-    int numberOfTriangles = 0;
-    _communication->receive(numberOfTriangles, rankSender);
-    DEBUG("Number of Triangles to receive: " << numberOfTriangles);
-    DEBUG("Number of Edges: " << edges.size());
-    if (numberOfTriangles > 0) {
-      assertion((edges.size() > 0) || (numberOfTriangles == 0));
-      std::vector<int> edgeIDs;
-      _communication->receive(edgeIDs, rankSender);
-      std::map<int, mesh::Edge *> edgeMap;
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeMap[edgeIDs[i]] = edges[i];
-      }
-
-      std::vector<int> triangleIDs;
-      _communication->receive(triangleIDs, rankSender);
+  indices.clear();
+  for (auto const &edge : mesh.edges()) {
+    indices.push_back(vertexPositions[edge.vertex(0).getID()]);
+    indices.push_back(vertexPositions[edge.vertex(1).getID()]);
+  }
+  appendDeltas(connectivity, indices);
 
-      for (int i = 0; i < numberOfTriangles; i++) {
-        assertion(edgeMap.find(triangleIDs[i * 3]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 1]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 2]) != edgeMap.end());
-        assertion(triangleIDs[i * 3] != triangleIDs[i * 3 + 1]);
-        assertion(triangleIDs[i * 3 + 1] != triangleIDs[i * 3 + 2]);
-        assertion(triangleIDs[i * 3 + 2] != triangleIDs[i * 3]);
-        mesh.createTriangle(*edgeMap[triangleIDs[i * 3]], *edgeMap[triangleIDs[i * 3 + 1]], *edgeMap[triangleIDs[i * 3 + 2]]);
-      }
+  indices.clear();
+  for (auto const &triangle : mesh.triangles()) {
+    for (int j = 0; j < 3; j++) {
+      assertion(edgePositions[triangle.edge(j).getID()] >= 0);
+      indices.push_back(edgePositions[triangle.edge(j).getID()]);
     }
   }
+  appendDeltas(connectivity, indices);
+
+  size_t           coordsSize = numberOfVertices * dim * sizeof(double) / sizeof(int);
+  std::vector<int> message(HEADER_SIZE + coordsSize + (connectivity.size() + sizeof(int) - 1) / sizeof(int));
+  message[0] = numberOfVertices;
+  message[1] = numberOfEdges;
+  message[2] = numberOfTriangles;
+  message[3] = connectivity.size();
+
+  auto coords = reinterpret_cast<unsigned char *>(&message[HEADER_SIZE]);
+  for (auto const &vertex : mesh.vertices()) {
+    std::memcpy(coords, vertex.getCoords().data(), dim * sizeof(double));
+    coords += dim * sizeof(double);
+  }
+  std::memcpy(&message[HEADER_SIZE + coordsSize], connectivity.data(), connectivity.size());
+
+  return message;
 }
 
-void CommunicateMesh::broadcastSendMesh(const mesh::Mesh &mesh)
+void CommunicateMesh::unpackMesh(std::vector<int> const &message, mesh::Mesh &mesh)
 {
-  TRACE(mesh.getName());
-  int dim = mesh.getDimensions();
-
-  int numberOfVertices = mesh.vertices().size();
-  _communication->broadcast(numberOfVertices);
-  if (numberOfVertices > 0) {
-    std::vector<double> coords(numberOfVertices * dim);
-    std::vector<int> globalIDs(numberOfVertices);
-    for (int i = 0; i < numberOfVertices; i++) {
-      for (int d = 0; d < dim; d++) {
-        coords[i * dim + d] = mesh.vertices()[i].getCoords()[d];
-      }
-      globalIDs[i] = mesh.vertices()[i].getGlobalIndex();
-    }
-    _communication->broadcast(coords);
-    _communication->broadcast(globalIDs);
+  assertion(message.size() >= HEADER_SIZE, message.size());
+  int dim               = mesh.getDimensions();
+  int numberOfVertices  = message[0];
+  int numberOfEdges     = message[1];
+  int numberOfTriangles = message[2];
+  DEBUG("Number of vertices, edges, and triangles to receive: " << numberOfVertices << ", "
+                                                                << numberOfEdges << ", " << numberOfTriangles);
+
+  size_t coordsSize = numberOfVertices * dim * sizeof(double) / sizeof(int);
+  assertion(message.size() * sizeof(int) >= (HEADER_SIZE + coordsSize) * sizeof(int) + message[3]);
+
+  std::vector<double> coords(numberOfVertices * dim);
+  std::memcpy(coords.data(), &message[HEADER_SIZE], coords.size() * sizeof(double));
+  auto connectivity = reinterpret_cast<const unsigned char *>(&message[HEADER_SIZE + coordsSize]);
+
+  std::vector<mesh::Vertex *> vertices(numberOfVertices);
+  mesh.vertices().reserve(mesh.vertices().size() + numberOfVertices);
+  int globalIndex = 0;
+  for (int i = 0; i < numberOfVertices; i++) {
+    mesh::Vertex &v = mesh.createVertex(Eigen::Map<const Eigen::VectorXd>(&coords[i * dim], dim));
+    assertion(v.getID() >= 0, v.getID());
+    globalIndex += readVarint(connectivity);
+    v.setGlobalIndex(globalIndex);
+    vertices[i] = &v;
   }
 
-  int numberOfEdges = mesh.edges().size();
-  _communication->broadcast(numberOfEdges);
-  if (numberOfEdges > 0) {
-    //we need to send the vertexIDs first such that the right edges can be created later
-    //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-    std::vector<int> vertexIDs(numberOfVertices);
-    for (int i = 0; i < numberOfVertices; i++) {
-      vertexIDs[i] = mesh.vertices()[i].getID();
-    }
-    _communication->broadcast(vertexIDs);
-
-    std::vector<int> edgeIDs(numberOfEdges * 2);
-    for (int i = 0; i < numberOfEdges; i++) {
-      edgeIDs[i * 2]     = mesh.edges()[i].vertex(0).getID();
-      edgeIDs[i * 2 + 1] = mesh.edges()[i].vertex(1).getID();
-    }
-    _communication->broadcast(edgeIDs);
+  std::vector<mesh::Edge *> edges(numberOfEdges);
+  mesh.edges().reserve(mesh.edges().size() + numberOfEdges);
+  int vertexIndex = 0;
+  for (int i = 0; i < numberOfEdges; i++) {
+    int vertexIndex0 = (vertexIndex += readVarint(connectivity));
+    int vertexIndex1 = (vertexIndex += readVarint(connectivity));
+    assertion(vertexIndex0 >= 0 && vertexIndex0 < numberOfVertices, vertexIndex0);
+    assertion(vertexIndex1 >= 0 && vertexIndex1 < numberOfVertices, vertexIndex1);
+    assertion(vertexIndex0 != vertexIndex1);
+    edges[i] = &mesh.createEdge(*vertices[vertexIndex0], *vertices[vertexIndex1]);
   }
 
-  if (dim == 3) {
-    int numberOfTriangles = mesh.triangles().size();
-    _communication->broadcast(numberOfTriangles);
-    if (numberOfTriangles > 0) {
-      //we need to send the edgeIDs first such that the right edges can be created later
-      //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-      std::vector<int> edgeIDs(numberOfEdges);
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeIDs[i] = mesh.edges()[i].getID();
-      }
-      _communication->broadcast(edgeIDs, numberOfEdges);
-
-      std::vector<int> triangleIDs(numberOfTriangles * 3);
-      for (int i = 0; i < numberOfTriangles; i++) {
-        triangleIDs[i * 3]     = mesh.triangles()[i].edge(0).getID();
-        triangleIDs[i * 3 + 1] = mesh.triangles()[i].edge(1).getID();
-        triangleIDs[i * 3 + 2] = mesh.triangles()[i].edge(2).getID();
-      }
-      _communication->broadcast(triangleIDs);
-    }
+  mesh.triangles().reserve(mesh.triangles().size() + numberOfTriangles);
+  int edgeIndex = 0;
+  for (int i = 0; i < numberOfTriangles; i++) {
+    int edgeIndices[3];
+    for (int j = 0; j < 3; j++) {
+      edgeIndices[j] = (edgeIndex += readVarint(connectivity));
+      assertion(edgeIndices[j] >= 0 && edgeIndices[j] < numberOfEdges, edgeIndices[j]);
+    }
+    assertion(edgeIndices[0] != edgeIndices[1]);
+    assertion(edgeIndices[1] != edgeIndices[2]);
+    assertion(edgeIndices[2] != edgeIndices[0]);
+    mesh.createTriangle(*edges[edgeIndices[0]], *edges[edgeIndices[1]], *edges[edgeIndices[2]]);
   }
 }
 
-void CommunicateMesh::broadcastReceiveMesh(
-    mesh::Mesh &mesh)
+CommunicateMesh::CommunicateMesh(
+    com::PtrCommunication communication)
+    : _communication(communication)
 {
-  TRACE(mesh.getName());
-  int dim             = mesh.getDimensions();
-  int rankBroadcaster = 0;
-
-  std::vector<mesh::Vertex *>   vertices;
-  std::map<int, mesh::Vertex *> vertexMap;
-  int                           numberOfVertices = 0;
-  _communication->broadcast(numberOfVertices, rankBroadcaster);
-
-  if (numberOfVertices > 0) {
-    std::vector<double> vertexCoords;
-    std::vector<int> globalIDs;
-    _communication->broadcast(vertexCoords, rankBroadcaster);
-    _communication->broadcast(globalIDs, rankBroadcaster);
-    for (int i = 0; i < numberOfVertices; i++) {
-      Eigen::VectorXd coords(dim);
-      for (int d = 0; d < dim; d++) {
-        coords[d] = vertexCoords[i * dim + d];
-      }
-      mesh::Vertex &v = mesh.createVertex(coords);
-      assertion(v.getID() >= 0, v.getID());
-      v.setGlobalIndex(globalIDs[i]);
-      vertices.push_back(&v);
-    }
-  }
-
-  int                       numberOfEdges = 0;
-  std::vector<mesh::Edge *> edges;
-  _communication->broadcast(numberOfEdges, rankBroadcaster);
-  if (numberOfEdges > 0) {
-    std::vector<int> vertexIDs;
-    _communication->broadcast(vertexIDs, rankBroadcaster);
-    for (int i = 0; i < numberOfVertices; i++) {
-      vertexMap[vertexIDs[i]] = vertices[i];
-    }
+}
 
-    std::vector<int> edgeIDs;
-    _communication->broadcast(edgeIDs, rankBroadcaster);
-    for (int i = 0; i < numberOfEdges; i++) {
-      assertion(vertexMap.find(edgeIDs[i * 2]) != vertexMap.end());
-      assertion(vertexMap.find(edgeIDs[i * 2 + 1]) != vertexMap.end());
-      assertion(edgeIDs[i * 2] != edgeIDs[i * 2 + 1]);
-      mesh::Edge &e = mesh.createEdge(*vertexMap[edgeIDs[i * 2]], *vertexMap[edgeIDs[i * 2 + 1]]);
-      edges.push_back(&e);
-    }
-  }
+void CommunicateMesh::sendMesh(
+    const mesh::Mesh &mesh,
+    int               rankReceiver)
+{
+  TRACE(mesh.getName(), rankReceiver);
+  std::vector<int> message = packMesh(mesh);
+  DEBUG("Size of mesh message: " << message.size());
+  _communication->send(message, rankReceiver);
+}
 
-  if (dim == 3) {
-    int numberOfTriangles = 0;
-    _communication->broadcast(numberOfTriangles, rankBroadcaster);
-    if (numberOfTriangles > 0) {
-      assertion((edges.size() > 0) || (numberOfTriangles == 0));
-      std::vector<int> edgeIDs;
-      _communication->broadcast(edgeIDs, rankBroadcaster);
-      std::map<int, mesh::Edge *> edgeMap;
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeMap[edgeIDs[i]] = edges[i];
-      }
+void CommunicateMesh::receiveMesh(
+    mesh::Mesh &mesh,
+    int         rankSender)
+{
+  TRACE(mesh.getName(), rankSender);
+  std::vector<int> message;
+  _communication->receive(message, rankSender);
+  DEBUG("Size of mesh message: " << message.size());
+  unpackMesh(message, mesh);
+}
 
-      std::vector<int> triangleIDs;
-      _communication->broadcast(triangleIDs, rankBroadcaster);
+void CommunicateMesh::broadcastSendMesh(const mesh::Mesh &mesh)
+{
+  TRACE(mesh.getName());
+  _communication->broadcast(packMesh(mesh));
+}
 
-      for (int i = 0; i < numberOfTriangles; i++) {
-        assertion(edgeMap.find(triangleIDs[i * 3]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 1]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 2]) != edgeMap.end());
-        assertion(triangleIDs[i * 3] != triangleIDs[i * 3 + 1]);
-        assertion(triangleIDs[i * 3 + 1] != triangleIDs[i * 3 + 2]);
-        assertion(triangleIDs[i * 3 + 2] != triangleIDs[i * 3]);
-        mesh.createTriangle(*edgeMap[triangleIDs[i * 3]], *edgeMap[triangleIDs[i * 3 + 1]], *edgeMap[triangleIDs[i * 3 + 2]]);
-      }
-    }
-  }
+void CommunicateMesh::broadcastReceiveMesh(
+    mesh::Mesh &mesh)
+{
+  TRACE(mesh.getName());
+  int              rankBroadcaster = 0;
+  std::vector<int> message;
+  _communication->broadcast(message, rankBroadcaster);
+  unpackMesh(message, mesh);
 }
 
 void CommunicateMesh::sendBoundingBox(
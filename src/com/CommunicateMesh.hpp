@@ -1,5 +1,6 @@
 #pragma once
 
+#include <vector>
 #include "com/SharedPointer.hpp"
 #include "logging/Logger.hpp"
 #include "mesh/Mesh.hpp"
@@ -9,7 +10,11 @@ namespace precice
 namespace com
 {
 
-/// Copies a Mesh object from a sender to a receiver.
+/**
+ * @brief Copies a Mesh object from a sender to a receiver.
+ *
+ * A mesh is transferred as a single message, see packMesh().
+ */
 class CommunicateMesh
 {
 public:
@@ -43,6 +48,18 @@ public:
 
 private:
   logging::Logger _log{"com::CommunicateMesh"};
+
+  /**
+   * @brief Serializes the vertices, edges, and triangles of the mesh into a single message.
+   *
+   * The message holds the element counts, the vertex coordinates, and the varint encoded
+   * differences of the global vertex indices and the connectivity. Edges and triangles
+   * refer to the zero-based positions of their vertices and edges in the message.
+   */
+  std::vector<int> packMesh(const mesh::Mesh &mesh);
+
+  /// Creates the vertices, edges, and triangles of a message written by packMesh() in the mesh.
+  void unpackMesh(std::vector<int> const &message, mesh::Mesh &mesh);
   
   /// Communication means used for the transfer of the geometry.
   com::PtrCommunication _communication;
@@ -1,10 +1,182 @@
 #include "Communication.hpp"
+#include <algorithm>
+#include "CommunicationFactory.hpp"
+#include "PersistentRequest.hpp"
 #include "Request.hpp"
+#include "utils/assertion.hpp"
 
 namespace precice
 {
 namespace com
 {
+namespace
+{
+/**
+ * @brief Returns the span of the subtree of the given rank in the binomial tree.
+ *
+ * The span is the lowest set bit of the rank. The master spans the whole tree,
+ * the children of a rank r are r + 2^k for all 2^k smaller than its span.
+ */
+int treeSpan(int rank, int size)
+{
+  int span = 1;
+  while (span < size and (rank & span) == 0) {
+    span <<= 1;
+  }
+  return span;
+}
+
+int numberOfTreeChildren(int rank, int size)
+{
+  int numberOfChildren = 0;
+  for (int step = 1; step < treeSpan(rank, size) and rank + step < size; step <<= 1) {
+    numberOfChildren++;
+  }
+  return numberOfChildren;
+}
+} // namespace
+
+PtrRequest Communication::aRequestConnectionAsClient(std::string const &nameAcceptor,
+                                                     std::string const &nameRequester)
+{
+  requestConnectionAsClient(nameAcceptor, nameRequester);
+  return PtrRequest();
+}
+
+std::string Communication::addressFilePath(std::string const &nameAcceptor,
+                                           std::string const &nameRequester) const
+{
+  return "";
+}
+
+void Communication::connectTree(CommunicationFactory &factory,
+                                std::string const &   name,
+                                int                   rank,
+                                int                   size)
+{
+  TRACE(name, rank, size);
+  assertion(not _useTree);
+
+  // With two ranks, the tree coincides with the master-slave connection.
+  if (size <= 2) {
+    return;
+  }
+
+  // Connect bottom-up, such that the children are waiting as soon as a rank accepts.
+  if (numberOfTreeChildren(rank, size) > 0) {
+    _treeChildren = factory.newCommunication();
+    _treeChildren->acceptConnection(name + std::to_string(rank), name + "Children" + std::to_string(rank));
+  }
+  if (rank > 0) {
+    int span       = treeSpan(rank, size);
+    int parent     = rank - span;
+    int childIndex = 0;
+    while ((1 << childIndex) < span) {
+      childIndex++;
+    }
+    _treeParent = factory.newCommunication();
+    _treeParent->requestConnection(name + std::to_string(parent), name + "Children" + std::to_string(parent),
+                                   childIndex, numberOfTreeChildren(parent, size));
+  }
+  _useTree = true;
+}
+
+void Communication::closeTree()
+{
+  TRACE();
+
+  if (_treeChildren) {
+    _treeChildren->closeConnection();
+    _treeChildren.reset();
+  }
+  if (_treeParent) {
+    _treeParent->closeConnection();
+    _treeParent.reset();
+  }
+  _useTree = false;
+}
+
+void Communication::connectRing(CommunicationFactory &factory,
+                                std::string const &   name,
+                                int                   rank,
+                                int                   size)
+{
+  TRACE(name, rank, size);
+  assertion(size > 1, size);
+
+  if (_ringLeft) {
+    return;
+  }
+
+  // The connection between rank r and r+1 is named after r. Even ranks accept first and
+  // odd ranks request first, such that the blocking connection setup does not deadlock.
+  int         prevRank  = (rank - 1 < 0) ? size - 1 : rank - 1;
+  std::string leftName  = name + std::to_string(prevRank);
+  std::string rightName = name + std::to_string(rank);
+  _ringLeft             = factory.newCommunication();
+  _ringRight            = factory.newCommunication();
+  if (rank % 2 == 0) {
+    _ringLeft->acceptConnection(leftName, leftName + "Next");
+    _ringRight->requestConnection(rightName, rightName + "Next", 0, 1);
+  } else {
+    _ringRight->requestConnection(rightName, rightName + "Next", 0, 1);
+    _ringLeft->acceptConnection(leftName, leftName + "Next");
+  }
+}
+
+void Communication::closeRing()
+{
+  TRACE();
+
+  if (_ringLeft) {
+    _ringLeft->closeConnection();
+    _ringLeft.reset();
+  }
+  if (_ringRight) {
+    _ringRight->closeConnection();
+    _ringRight.reset();
+  }
+}
+
+template <typename T>
+void Communication::treeReduceSum(const T *itemsToSend, T *itemsToReceive, int size)
+{
+  std::vector<T> sum(itemsToSend, itemsToSend + size);
+  std::vector<T> received(size);
+
+  if (_treeChildren) {
+    for (int child = 0; child < static_cast<int>(_treeChildren->getRemoteCommunicatorSize()); ++child) {
+      _treeChildren->receive(received.data(), size, child);
+      for (int i = 0; i < size; i++) {
+        sum[i] += received[i];
+      }
+    }
+  }
+
+  if (_treeParent) {
+    _treeParent->send(sum.data(), size, 0);
+  } else {
+    std::copy(sum.begin(), sum.end(), itemsToReceive);
+  }
+}
+
+template <typename T>
+void Communication::treeBroadcast(T *items, int size)
+{
+  if (_treeParent) {
+    _treeParent->receive(items, size, 0);
+  }
+
+  if (_treeChildren) {
+    // Serve the largest subtree first, since it takes longest to pass the items on.
+    std::vector<PtrRequest> requests;
+    for (int child = static_cast<int>(_treeChildren->getRemoteCommunicatorSize()) - 1; child >= 0; --child) {
+      requests.push_back(_treeChildren->aSend(items, size, child));
+    }
+    Request::wait(requests);
+  }
+}
+
 /**
  * @attention This method modifies the input buffer.
  */
@@ -12,6 +184,11 @@ void Communication::reduceSum(double *itemsToSend, double *itemsToReceive, int s
 {
   TRACE(size);
 
+  if (_useTree) {
+    treeReduceSum(itemsToSend, itemsToReceive, size);
+    return;
+  }
+
   std::copy(itemsToSend, itemsToSend + size, itemsToReceive);
   
   // receive local results from slaves
@@ -28,6 +205,11 @@ void Communication::reduceSum(double *itemsToSend, double *itemsToReceive, int s
 {
   TRACE(size);
 
+  if (_useTree) {
+    treeReduceSum(itemsToSend, itemsToReceive, size);
+    return;
+  }
+
   auto request = aSend(itemsToSend, size, rankMaster);
   request->wait();
 }
@@ -36,6 +218,11 @@ void Communication::reduceSum(int itemToSend, int &itemToReceive)
 {
   TRACE();
 
+  if (_useTree) {
+    treeReduceSum(&itemToSend, &itemToReceive, 1);
+    return;
+  }
+
   itemToReceive = itemToSend;
 
   // receive local results from slaves
@@ -50,6 +237,11 @@ void Communication::reduceSum(int itemToSend, int &itemToReceive, int rankMaster
 {
   TRACE();
 
+  if (_useTree) {
+    treeReduceSum(&itemToSend, &itemToReceive, 1);
+    return;
+  }
+
   auto request = aSend(&itemToSend, 1, rankMaster);
   request->wait();
 }
@@ -61,6 +253,12 @@ void Communication::allreduceSum(double *itemsToSend, double *itemsToReceive, in
 {
   TRACE(size);
 
+  if (_useTree) {
+    treeReduceSum(itemsToSend, itemsToReceive, size);
+    treeBroadcast(itemsToReceive, size);
+    return;
+  }
+
   std::copy(itemsToSend, itemsToSend + size, itemsToReceive);
   
   // receive local results from slaves
@@ -88,6 +286,12 @@ void Communication::allreduceSum(double *itemsToSend, double *itemsToReceive, in
 {
   TRACE(size);
 
+  if (_useTree) {
+    treeReduceSum(itemsToSend, itemsToReceive, size);
+    treeBroadcast(itemsToReceive, size);
+    return;
+  }
+
   auto request = aSend(itemsToSend, size, rankMaster);
   request->wait();
   // receive reduced data from master
@@ -98,6 +302,12 @@ void Communication::allreduceSum(double itemToSend, double &itemToReceive)
 {
   TRACE();
 
+  if (_useTree) {
+    treeReduceSum(&itemToSend, &itemToReceive, 1);
+    treeBroadcast(&itemToReceive, 1);
+    return;
+  }
+
   itemToReceive = itemToSend;
 
   // receive local results from slaves
@@ -120,6 +330,12 @@ void Communication::allreduceSum(double itemToSend, double &itemsToReceive, int
 {
   TRACE();
 
+  if (_useTree) {
+    treeReduceSum(&itemToSend, &itemsToReceive, 1);
+    treeBroadcast(&itemsToReceive, 1);
+    return;
+  }
+
   auto request = aSend(&itemToSend, 1, rankMaster);
   request->wait();
   // receive reduced data from master
@@ -130,6 +346,12 @@ void Communication::allreduceSum(int itemToSend, int &itemToReceive)
 {
   TRACE();
 
+  if (_useTree) {
+    treeReduceSum(&itemToSend, &itemToReceive, 1);
+    treeBroadcast(&itemToReceive, 1);
+    return;
+  }
+
   itemToReceive = itemToSend;
 
   // receive local results from slaves
@@ -152,6 +374,12 @@ void Communication::allreduceSum(int itemToSend, int &itemToReceive, int rankMas
 {
   TRACE();
 
+  if (_useTree) {
+    treeReduceSum(&itemToSend, &itemToReceive, 1);
+    treeBroadcast(&itemToReceive, 1);
+    return;
+  }
+
   auto request = aSend(&itemToSend, 1, rankMaster);
   request->wait();
   // receive reduced data from master
@@ -162,6 +390,11 @@ void Communication::broadcast(const int *itemsToSend, int size)
 {
   TRACE(size);
 
+  if (_useTree) {
+    treeBroadcast(const_cast<int *>(itemsToSend), size);
+    return;
+  }
+
   std::vector<PtrRequest> requests(getRemoteCommunicatorSize());
 
   for (size_t rank = 0; rank < getRemoteCommunicatorSize(); ++rank) {
@@ -177,6 +410,11 @@ void Communication::broadcast(int *itemsToReceive, int size, int rankBroadcaster
 {
   TRACE(size);
 
+  if (_useTree) {
+    treeBroadcast(itemsToReceive, size);
+    return;
+  }
+
   receive(itemsToReceive, size, rankBroadcaster + _rankOffset);
 }
 
@@ -184,6 +422,11 @@ void Communication::broadcast(int itemToSend)
 {
   TRACE();
 
+  if (_useTree) {
+    treeBroadcast(&itemToSend, 1);
+    return;
+  }
+
   std::vector<PtrRequest> requests(getRemoteCommunicatorSize());
 
   for (size_t rank = 0; rank < getRemoteCommunicatorSize(); ++rank) {
@@ -197,6 +440,12 @@ void Communication::broadcast(int itemToSend)
 void Communication::broadcast(int &itemToReceive, int rankBroadcaster)
 {
   TRACE();
+
+  if (_useTree) {
+    treeBroadcast(&itemToReceive, 1);
+    return;
+  }
+
   receive(itemToReceive, rankBroadcaster + _rankOffset);
 }
 
@@ -204,6 +453,11 @@ void Communication::broadcast(const double *itemsToSend, int size)
 {
   TRACE(size);
 
+  if (_useTree) {
+    treeBroadcast(const_cast<double *>(itemsToSend), size);
+    return;
+  }
+
   std::vector<PtrRequest> requests(getRemoteCommunicatorSize());
 
   for (size_t rank = 0; rank < getRemoteCommunicatorSize(); ++rank) {
@@ -220,6 +474,12 @@ void Communication::broadcast(double *itemsToReceive,
                               int     rankBroadcaster)
 {
   TRACE(size);
+
+  if (_useTree) {
+    treeBroadcast(itemsToReceive, size);
+    return;
+  }
+
   receive(itemsToReceive, size, rankBroadcaster + _rankOffset);
 }
 
@@ -227,6 +487,11 @@ void Communication::broadcast(double itemToSend)
 {
   TRACE();
 
+  if (_useTree) {
+    treeBroadcast(&itemToSend, 1);
+    return;
+  }
+
   std::vector<PtrRequest> requests(getRemoteCommunicatorSize());
 
   for (size_t rank = 0; rank < getRemoteCommunicatorSize(); ++rank) {
@@ -241,6 +506,12 @@ void Communication::broadcast(double itemToSend)
 void Communication::broadcast(double &itemToReceive, int rankBroadcaster)
 {
   TRACE();
+
+  if (_useTree) {
+    treeBroadcast(&itemToReceive, 1);
+    return;
+  }
+
   receive(itemToReceive, rankBroadcaster + _rankOffset);
 }
 
@@ -289,5 +560,23 @@ void Communication::broadcast(std::vector<double> &v, int rankBroadcaster)
   broadcast(v.data(), size, rankBroadcaster);
 }
 
+PtrRequest Communication::sendInit(const double *itemsToSend, int size, int rankReceiver)
+{
+  TRACE(size, rankReceiver);
+
+  return PtrRequest(new PersistentRequest([this, itemsToSend, size, rankReceiver] {
+    return aSend(itemsToSend, size, rankReceiver);
+  }));
+}
+
+PtrRequest Communication::receiveInit(double *itemsToReceive, int size, int rankSender)
+{
+  TRACE(size, rankSender);
+
+  return PtrRequest(new PersistentRequest([this, itemsToReceive, size, rankSender] {
+    return aReceive(itemsToReceive, size, rankSender);
+  }));
+}
+
 } // namespace com
 } // namespace precice
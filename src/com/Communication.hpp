@@ -1,6 +1,9 @@
 #pragma once
 
+#include <string>
+#include <vector>
 #include "Request.hpp"
+#include "com/SharedPointer.hpp"
 #include "logging/Logger.hpp"
 
 namespace precice
@@ -125,6 +128,29 @@ public:
   virtual int requestConnectionAsClient(std::string const &nameAcceptor,
                                         std::string const &nameRequester) = 0;
 
+  /**
+   * @brief Starts to connect to another communicator, which has to call acceptConnectionAsServer().
+   *
+   * Non-blocking variant of requestConnectionAsClient(), such that a requester can connect to
+   * several acceptors concurrently. The connection may only be used after the returned request
+   * has completed. The default implementation connects immediately and returns nullptr, which
+   * is ignored by Request::wait().
+   *
+   * @param[in] nameAcceptor Name of calling participant.
+   * @param[in] nameRequester Name of remote participant to connect to.
+   */
+  virtual PtrRequest aRequestConnectionAsClient(std::string const &nameAcceptor,
+                                                std::string const &nameRequester);
+
+  /**
+   * @brief Returns the path of the file, in which acceptConnectionAsServer() publishes its address.
+   *
+   * Allows to wait for the addresses of several acceptors at once, see utils::Publisher::waitForFiles().
+   * Returns an empty string, if the address is not exchanged by file.
+   */
+  virtual std::string addressFilePath(std::string const &nameAcceptor,
+                                      std::string const &nameRequester) const;
+
   /**
    * @brief Disconnects from communication space, i.e. participant.
    *
@@ -132,6 +158,57 @@ public:
    */
   virtual void closeConnection() = 0;
 
+  /**
+   * @brief Connects the master and the slaves additionally along a binomial tree.
+   *
+   * Afterwards, the default implementations of reduceSum(), allreduceSum() and broadcast()
+   * pass the data along the tree instead of looping over all slaves at the master, such that
+   * every rank sends and receives at most log2(size) messages per collective. The slaves are
+   * otherwise only connected to the master, hence, every inner node of the tree accepts a
+   * connection from its children, which are created by the given factory. Has to be called
+   * by all ranks after the master-slave connection has been set up. Backends with native
+   * collectives, i.e. MPIDirectCommunication, override the collectives and ignore the tree.
+   *
+   * @param[in] factory Creates the connections to the parent and the children.
+   * @param[in] name Name of the tree, has to be unique among all connections.
+   * @param[in] rank Rank of the calling process, the master has rank 0.
+   * @param[in] size Number of processes, including the master.
+   */
+  void connectTree(CommunicationFactory &factory, std::string const &name, int rank, int size);
+
+  /// Disconnects the binomial tree, see connectTree().
+  void closeTree();
+
+  /**
+   * @brief Connects every rank additionally to its neighbours in a ring.
+   *
+   * Rank r receives from rank r-1 through getRingLeft() and sends to rank r+1 through
+   * getRingRight(), with periodic wrap-around. The connections are created by the given
+   * factory, as the slaves are otherwise only connected to the master. Has to be called by
+   * all ranks, a second call is a no-op, such that several users can share the ring.
+   *
+   * @param[in] factory Creates the connections to the neighbours.
+   * @param[in] name Name of the ring, has to be unique among all connections.
+   * @param[in] rank Rank of the calling process, the master has rank 0.
+   * @param[in] size Number of processes, including the master.
+   */
+  void connectRing(CommunicationFactory &factory, std::string const &name, int rank, int size);
+
+  /// Disconnects the ring, see connectRing().
+  void closeRing();
+
+  /// Returns the connection to the previous rank in the ring, nullptr if not connected.
+  PtrCommunication getRingLeft() const
+  {
+    return _ringLeft;
+  }
+
+  /// Returns the connection to the next rank in the ring, nullptr if not connected.
+  PtrCommunication getRingRight() const
+  {
+    return _ringRight;
+  }
+
   /// Performs a reduce summation on the rank given by rankMaster
   virtual void reduceSum(double *itemsToSend, double *itemsToReceive, int size, int rankMaster);
 
@@ -232,6 +309,26 @@ public:
                               int     size,
                               int     rankSender) = 0;
 
+  /**
+   * @brief Creates a persistent request for sending an array of double values.
+   *
+   * The returned request is inactive and has to be started by Request::start().
+   * After completion, it can be started again to send the current content of
+   * the same buffer to the same rank. This saves the setup of a new request
+   * for exchanges which are repeated with fixed partners and sizes. The
+   * buffer has to stay valid as long as the request exists.
+   *
+   * The default implementation issues aSend() on every start.
+   */
+  virtual PtrRequest sendInit(const double *itemsToSend, int size, int rankReceiver);
+
+  /**
+   * @brief Creates a persistent request for receiving an array of double values.
+   *
+   * @see sendInit()
+   */
+  virtual PtrRequest receiveInit(double *itemsToReceive, int size, int rankSender);
+
   /// Receives a double from process with given rank.
   virtual void receive(double &itemToReceive, int rankSender) = 0;
 
@@ -278,7 +375,30 @@ protected:
 
 private:
   logging::Logger _log{"com::Communication"};
-  
+
+  /// True, if the collectives are passed along the binomial tree, see connectTree().
+  bool _useTree = false;
+
+  /// Connection to the parent in the binomial tree, nullptr for the master.
+  PtrCommunication _treeParent;
+
+  /// Connection to the children in the binomial tree, ordered by the size of their subtrees.
+  PtrCommunication _treeChildren;
+
+  /// Connection to the previous rank in the ring, see connectRing().
+  PtrCommunication _ringLeft;
+
+  /// Connection to the next rank in the ring, see connectRing().
+  PtrCommunication _ringRight;
+
+  /// Sums up the items of all ranks along the tree, the result is only valid on the master.
+  template <typename T>
+  void treeReduceSum(const T *itemsToSend, T *itemsToReceive, int size);
+
+  /// Passes the items of the master down the tree to all slaves.
+  template <typename T>
+  void treeBroadcast(T *items, int size);
+
 };
 } // namespace com
 } // namespace precice
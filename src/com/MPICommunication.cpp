@@ -259,6 +259,40 @@ PtrRequest MPICommunication::aReceive(double *itemsToReceive, int size, int rank
   return PtrRequest(new MPIRequest(request));
 }
 
+PtrRequest MPICommunication::sendInit(const double *itemsToSend, int size, int rankReceiver)
+{
+  TRACE(size, rankReceiver);
+  rankReceiver = rankReceiver - _rankOffset;
+
+  MPI_Request request;
+  MPI_Send_init(const_cast<double*>(itemsToSend),
+                size,
+                MPI_DOUBLE,
+                rank(rankReceiver),
+                0,
+                communicator(rankReceiver),
+                &request);
+
+  return PtrRequest(new MPIRequest(request, true));
+}
+
+PtrRequest MPICommunication::receiveInit(double *itemsToReceive, int size, int rankSender)
+{
+  TRACE(size, rankSender);
+  rankSender = rankSender - _rankOffset;
+
+  MPI_Request request;
+  MPI_Recv_init(itemsToReceive,
+                size,
+                MPI_DOUBLE,
+                rank(rankSender),
+                0,
+                communicator(rankSender),
+                &request);
+
+  return PtrRequest(new MPIRequest(request, true));
+}
+
 void MPICommunication::receive(double &itemToReceive, int rankSender)
 {
   TRACE(rankSender);
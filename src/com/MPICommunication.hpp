@@ -97,6 +97,12 @@ public:
                               int     size,
                               int     rankSender) override;
 
+  /// Creates a persistent request for sending double values by MPI_Send_init.
+  virtual PtrRequest sendInit(const double *itemsToSend, int size, int rankReceiver) override;
+
+  /// Creates a persistent request for receiving double values by MPI_Recv_init.
+  virtual PtrRequest receiveInit(double *itemsToReceive, int size, int rankSender) override;
+
   /**
    * @brief Receives a double from process with given rank.
    *
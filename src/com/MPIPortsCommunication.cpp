@@ -229,6 +229,13 @@ int MPIPortsCommunication::requestConnectionAsClient(std::string const &nameAcce
   return _rank;
 }
 
+std::string MPIPortsCommunication::addressFilePath(std::string const &nameAcceptor,
+                                                   std::string const &nameRequester) const
+{
+  Publisher::ScopedChangePrefixDirectory scpd(_addressDirectory);
+  return Publisher("." + nameRequester + "-" + nameAcceptor + ".address").filePath();
+}
+
 void MPIPortsCommunication::closeConnection()
 {
   TRACE(_communicators.size());
@@ -46,6 +46,9 @@ public:
   virtual int requestConnectionAsClient(std::string const &nameAcceptor,
                                         std::string const &nameRequester) override;
 
+  virtual std::string addressFilePath(std::string const &nameAcceptor,
+                                      std::string const &nameRequester) const override;
+
   /// See precice::com::Communication::closeConnection().
   virtual void closeConnection() override;
 
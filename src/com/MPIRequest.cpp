@@ -1,16 +1,25 @@
 #ifndef PRECICE_NO_MPI
 
 #include "MPIRequest.hpp"
+#include "utils/assertion.hpp"
 
 namespace precice
 {
 namespace com
 {
-MPIRequest::MPIRequest(MPI_Request request)
-    : _request(request)
+MPIRequest::MPIRequest(MPI_Request request, bool persistent)
+    : _request(request),
+      _persistent(persistent)
 {
 }
 
+MPIRequest::~MPIRequest()
+{
+  if (_persistent && _request != MPI_REQUEST_NULL) {
+    MPI_Request_free(&_request);
+  }
+}
+
 bool MPIRequest::test()
 {
   int complete = 0;
@@ -24,6 +33,126 @@ void MPIRequest::wait()
 {
   MPI_Wait(&_request, MPI_STATUS_IGNORE);
 }
+
+void MPIRequest::start()
+{
+  assertion(_persistent, "Only persistent requests can be started.");
+  MPI_Start(&_request);
+}
+
+bool MPIRequest::isMPIOnly(std::vector<PtrRequest> const &requests)
+{
+  for (auto const &request : requests) {
+    if (request && not dynamic_cast<MPIRequest *>(request.get()))
+      return false;
+  }
+
+  return true;
+}
+
+void MPIRequest::waitAll(std::vector<PtrRequest> &requests)
+{
+  if (requests.empty())
+    return;
+
+  auto rawRequests = handles(requests);
+
+  MPI_Waitall(rawRequests.size(), rawRequests.data(), MPI_STATUSES_IGNORE);
+
+  update(requests, rawRequests);
+}
+
+void MPIRequest::startAll(std::vector<PtrRequest> &requests)
+{
+  if (requests.empty())
+    return;
+
+  // Null requests cannot be started, hence only the others are passed on.
+  std::vector<MPIRequest *> active;
+  std::vector<MPI_Request>  rawRequests;
+
+  for (auto const &request : requests) {
+    if (request) {
+      active.push_back(static_cast<MPIRequest *>(request.get()));
+      rawRequests.push_back(active.back()->_request);
+    }
+  }
+
+  if (rawRequests.empty())
+    return;
+
+  MPI_Startall(rawRequests.size(), rawRequests.data());
+
+  for (size_t i = 0; i < active.size(); ++i) {
+    active[i]->_request = rawRequests[i];
+  }
+}
+
+int MPIRequest::waitAny(std::vector<PtrRequest> &requests)
+{
+  if (requests.empty())
+    return -1;
+
+  auto rawRequests = handles(requests);
+  int  index       = MPI_UNDEFINED;
+
+  MPI_Waitany(rawRequests.size(), rawRequests.data(), &index, MPI_STATUS_IGNORE);
+
+  if (index == MPI_UNDEFINED)
+    return -1;
+
+  update(requests, rawRequests);
+  requests[index].reset();
+
+  return index;
+}
+
+std::vector<int> MPIRequest::testSome(std::vector<PtrRequest> &requests)
+{
+  if (requests.empty())
+    return {};
+
+  auto             rawRequests = handles(requests);
+  std::vector<int> indices(rawRequests.size());
+  int              count = 0;
+
+  MPI_Testsome(rawRequests.size(), rawRequests.data(), &count, indices.data(), MPI_STATUSES_IGNORE);
+
+  if (count == MPI_UNDEFINED)
+    count = 0;
+
+  indices.resize(count);
+  update(requests, rawRequests);
+
+  for (int index : indices) {
+    requests[index].reset();
+  }
+
+  return indices;
+}
+
+std::vector<MPI_Request> MPIRequest::handles(std::vector<PtrRequest> const &requests)
+{
+  std::vector<MPI_Request> rawRequests;
+  rawRequests.reserve(requests.size());
+
+  for (auto const &request : requests) {
+    if (request)
+      rawRequests.push_back(static_cast<MPIRequest *>(request.get())->_request);
+    else
+      rawRequests.push_back(MPI_REQUEST_NULL);
+  }
+
+  return rawRequests;
+}
+
+void MPIRequest::update(std::vector<PtrRequest> &requests, std::vector<MPI_Request> const &rawRequests)
+{
+  for (size_t i = 0; i < requests.size(); ++i) {
+    if (requests[i])
+      static_cast<MPIRequest *>(requests[i].get())->_request = rawRequests[i];
+  }
+}
 } // namespace com
 } // namespace precice
 
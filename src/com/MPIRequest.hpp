@@ -11,14 +11,48 @@ namespace com
 class MPIRequest : public Request
 {
 public:
-  MPIRequest(MPI_Request request);
+  /**
+   * @brief Wraps an MPI request handle.
+   *
+   * @param[in] request Handle of the request.
+   * @param[in] persistent True, if the request was created by MPI_Send_init or
+   *            MPI_Recv_init. Persistent requests are freed on destruction.
+   */
+  MPIRequest(MPI_Request request, bool persistent = false);
+
+  virtual ~MPIRequest();
 
   bool test();
 
   void wait();
 
+  void start();
+
+  /// Returns true, if all non-null requests are MPI requests.
+  static bool isMPIOnly(std::vector<PtrRequest> const &requests);
+
+  /// Implements Request::wait() by MPI_Waitall.
+  static void waitAll(std::vector<PtrRequest> &requests);
+
+  /// Implements Request::start() by MPI_Startall.
+  static void startAll(std::vector<PtrRequest> &requests);
+
+  /// Implements Request::waitAny() by MPI_Waitany.
+  static int waitAny(std::vector<PtrRequest> &requests);
+
+  /// Implements Request::testSome() by MPI_Testsome.
+  static std::vector<int> testSome(std::vector<PtrRequest> &requests);
+
 private:
   MPI_Request _request;
+
+  bool _persistent;
+
+  /// Collects the raw request handles, using MPI_REQUEST_NULL for null requests.
+  static std::vector<MPI_Request> handles(std::vector<PtrRequest> const &requests);
+
+  /// Writes back the raw request handles, which MPI has deactivated or freed.
+  static void update(std::vector<PtrRequest> &requests, std::vector<MPI_Request> const &rawRequests);
 };
 } // namespace com
 } // namespace precice
@@ -0,0 +1,36 @@
+#include "PersistentRequest.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice
+{
+namespace com
+{
+PersistentRequest::PersistentRequest(std::function<PtrRequest()> starter)
+    : _starter(std::move(starter))
+{
+}
+
+bool PersistentRequest::test()
+{
+  if (_request && _request->test()) {
+    _request.reset();
+  }
+
+  return not _request;
+}
+
+void PersistentRequest::wait()
+{
+  if (_request) {
+    _request->wait();
+    _request.reset();
+  }
+}
+
+void PersistentRequest::start()
+{
+  assertion(not _request, "Request has already been started.");
+  _request = _starter();
+}
+} // namespace com
+} // namespace precice
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <functional>
+#include "Request.hpp"
+
+namespace precice
+{
+namespace com
+{
+/**
+ * @brief Emulates a persistent request for communication backends without native support.
+ *
+ * Each start() issues a new asynchronous operation through the given function,
+ * whose request is then tested and waited for. Used by the default
+ * implementations of Communication::sendInit() and Communication::receiveInit().
+ */
+class PersistentRequest : public Request
+{
+public:
+  explicit PersistentRequest(std::function<PtrRequest()> starter);
+
+  bool test();
+
+  void wait();
+
+  void start();
+
+private:
+  /// Issues the asynchronous operation.
+  std::function<PtrRequest()> _starter;
+
+  /// Request of the currently active operation, or nullptr if inactive.
+  PtrRequest _request;
+};
+} // namespace com
+} // namespace precice
@@ -1,17 +1,151 @@
 #include "Request.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include "MPIRequest.hpp"
+#include "utils/assertion.hpp"
 
 namespace precice
 {
 namespace com
 {
+namespace
+{
+/// Number of times the predicate is evaluated in Request::waitUntil(), before the thread blocks.
+const int SPIN_COUNT = 100;
+
+std::mutex              completionMutex;
+std::condition_variable completionCondition;
+
+/// Number of threads blocked in Request::waitUntil().
+std::atomic<int> waitingThreads{0};
+} // namespace
 
 void Request::wait(std::vector<PtrRequest> &requests)
 {
-  for (auto request : requests) {
-    request->wait();
+#ifndef PRECICE_NO_MPI
+  if (MPIRequest::isMPIOnly(requests)) {
+    MPIRequest::waitAll(requests);
+    return;
+  }
+#endif
+
+  waitUntil([&requests] {
+    for (auto const &request : requests) {
+      if (request && not request->test())
+        return false;
+    }
+    return true;
+  });
+}
+
+void Request::start(std::vector<PtrRequest> &requests)
+{
+#ifndef PRECICE_NO_MPI
+  if (MPIRequest::isMPIOnly(requests)) {
+    MPIRequest::startAll(requests);
+    return;
+  }
+#endif
+
+  for (auto const &request : requests) {
+    if (request)
+      request->start();
   }
 }
 
+int Request::waitAny(std::vector<PtrRequest> &requests)
+{
+#ifndef PRECICE_NO_MPI
+  if (MPIRequest::isMPIOnly(requests)) {
+    return MPIRequest::waitAny(requests);
+  }
+#endif
+
+  bool pending = false;
+
+  for (auto const &request : requests) {
+    if (request) {
+      pending = true;
+      break;
+    }
+  }
+
+  if (not pending)
+    return -1;
+
+  int index = -1;
+
+  waitUntil([&requests, &index] {
+    for (size_t i = 0; i < requests.size(); ++i) {
+      if (requests[i] && requests[i]->test()) {
+        index = i;
+        return true;
+      }
+    }
+    return false;
+  });
+
+  requests[index].reset();
+  return index;
+}
+
+std::vector<int> Request::testSome(std::vector<PtrRequest> &requests)
+{
+#ifndef PRECICE_NO_MPI
+  if (MPIRequest::isMPIOnly(requests)) {
+    return MPIRequest::testSome(requests);
+  }
+#endif
+
+  std::vector<int> completed;
+
+  for (size_t i = 0; i < requests.size(); ++i) {
+    if (requests[i] && requests[i]->test()) {
+      requests[i].reset();
+      completed.push_back(i);
+    }
+  }
+
+  return completed;
+}
+
+void Request::notifyCompletion()
+{
+  // The completed state has to be stored before, such that either a waiting
+  // thread sees it, or it is counted here and woken up.
+  if (waitingThreads.load() > 0) {
+    std::lock_guard<std::mutex> lock(completionMutex);
+    completionCondition.notify_all();
+  }
+}
+
+void Request::waitUntil(std::function<bool()> const &predicate)
+{
+  for (int i = 0; i < SPIN_COUNT; ++i) {
+    if (predicate())
+      return;
+  }
+
+  waitingThreads++;
+
+  {
+    std::unique_lock<std::mutex> lock(completionMutex);
+
+    // Time out regularly to poll requests, which do not notify.
+    while (not completionCondition.wait_for(lock, std::chrono::milliseconds(1), predicate)) {
+    }
+  }
+
+  waitingThreads--;
+}
+
+void Request::start()
+{
+  assertion(false, "Only persistent requests can be started.");
+}
+
 Request::~Request()
 {
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <vector>
 #include "com/SharedPointer.hpp"
 
@@ -11,13 +12,68 @@ class Request
 {
 
 public:
+  /**
+   * @brief Blocks until all given requests have completed. Null requests are ignored.
+   *
+   * The calling thread blocks once for all requests, not once per request.
+   */
   static void wait(std::vector<PtrRequest> &requests);
 
+  /// Starts all given persistent requests, see start(). Null requests are ignored.
+  static void start(std::vector<PtrRequest> &requests);
+
+  /**
+   * @brief Blocks until any of the given requests has completed.
+   *
+   * The completed request is reset to nullptr, so that repeated calls iterate
+   * over all requests in the order of their completion. Null requests are
+   * ignored.
+   *
+   * @return Index of the completed request, or -1 if all requests are null.
+   */
+  static int waitAny(std::vector<PtrRequest> &requests);
+
+  /**
+   * @brief Tests all given requests without blocking.
+   *
+   * Completed requests are reset to nullptr. Null requests are ignored.
+   *
+   * @return Indices of the requests which have completed since the last call.
+   */
+  static std::vector<int> testSome(std::vector<PtrRequest> &requests);
+
   virtual ~Request();
 
   virtual bool test() = 0;
 
   virtual void wait() = 0;
+
+  /**
+   * @brief Starts a persistent request.
+   *
+   * Persistent requests are created by Communication::sendInit() and
+   * Communication::receiveInit(). They are inactive after creation and after
+   * completion, and can be started again as often as needed. Non-persistent
+   * requests cannot be started.
+   */
+  virtual void start();
+
+protected:
+  /**
+   * @brief Wakes up all threads blocked in waitUntil().
+   *
+   * Has to be called by requests, which are completed by another thread.
+   */
+  static void notifyCompletion();
+
+  /**
+   * @brief Blocks until the given predicate on the state of requests holds.
+   *
+   * Spins for a short while, then blocks until notifyCompletion() is called
+   * and evaluates the predicate again. Requests, which do not call
+   * notifyCompletion(), are polled.
+   */
+  static void waitUntil(std::function<bool()> const &predicate);
 };
 } // namespace com
 } // namespace precice
@@ -7,6 +7,9 @@
 #include "utils/Publisher.hpp"
 #include "utils/assertion.hpp"
 
+#include <algorithm>
+#include <array>
+#include <deque>
 #include <sstream>
 
 using precice::utils::Publisher;
@@ -19,16 +22,72 @@ namespace com
 
 namespace asio = boost::asio;
 
+namespace
+{
+/// Number of times a failed connection attempt is repeated, before the request fails.
+const int MAX_CONNECT_RETRIES = 100;
+
+/// Upper bound of the delay between two connection attempts in milliseconds.
+const int MAX_CONNECT_DELAY = 1000;
+} // namespace
+
+/// Asynchronous operation on a socket, which waits for the preceding ones of the same direction.
+template <typename Buffer>
+struct PendingOperation {
+  Buffer                             buffer;
+  std::shared_ptr<std::vector<char>> copy;
+  PtrRequest                         request;
+};
+
+/**
+ * @brief Queued asynchronous operations on the socket of one rank.
+ *
+ * Asio allows only one write and one read in progress per socket, hence the
+ * front of each queue is in progress and its completion handler starts the
+ * next one. The queues are only accessed from handlers of the strand.
+ */
+struct SocketCommunication::Channel {
+  explicit Channel(IOService &ioService)
+      : strand(ioService)
+  {
+  }
+
+  IOService::strand strand;
+
+  std::deque<PendingOperation<asio::const_buffer>> writes;
+
+  std::deque<PendingOperation<asio::mutable_buffer>> reads;
+};
+
+/// Connection attempt of asyncConnect(), which is repeated until the acceptor accepts.
+struct SocketCommunication::ConnectAttempt {
+  asio::ip::tcp::endpoint endpoint;
+  std::string             address;
+  PtrRequest              request;
+  int                     retries = 0;
+};
+
 SocketCommunication::SocketCommunication(unsigned short     portNumber,
                                          bool               reuseAddress,
                                          std::string const &networkName,
-                                         std::string const &addressDirectory)
+                                         std::string const &addressDirectory,
+                                         int                ioThreadCount,
+                                         bool               noDelay,
+                                         int                sendBufferSize,
+                                         int                receiveBufferSize)
     : _portNumber(portNumber),
       _reuseAddress(reuseAddress),
       _networkName(networkName),
       _addressDirectory(addressDirectory),
-      _ioService(new IOService)
+      _ioThreadCount(ioThreadCount),
+      _noDelay(noDelay),
+      _sendBufferSize(sendBufferSize),
+      _receiveBufferSize(receiveBufferSize),
+      _ioService(new IOService),
+      _requestPool(std::make_shared<SocketRequestPool>())
 {
+  assertion(_ioThreadCount > 0, _ioThreadCount);
+
   if (_addressDirectory.empty()) {
     _addressDirectory = ".";
   }
@@ -78,6 +137,10 @@ void SocketCommunication::acceptConnection(std::string const &nameAcceptor,
 
       acceptor.open(endpoint.protocol());
       acceptor.set_option(tcp::acceptor::reuse_address(_reuseAddress));
+      if (_receiveBufferSize > 0) {
+        // Set before listening, such that accepted sockets inherit the TCP window.
+        acceptor.set_option(asio::socket_base::receive_buffer_size(_receiveBufferSize));
+      }
       acceptor.bind(endpoint);
       acceptor.listen();
 
@@ -97,6 +160,7 @@ void SocketCommunication::acceptConnection(std::string const &nameAcceptor,
     PtrSocket socket(new Socket(*_ioService));
 
     acceptor.accept(*socket);
+    setSocketOptions(*socket);
 
     DEBUG("Accepted connection at " << address);
 
@@ -123,6 +187,7 @@ void SocketCommunication::acceptConnection(std::string const &nameAcceptor,
       socket = PtrSocket(new Socket(*_ioService));
 
       acceptor.accept(*socket);
+      setSocketOptions(*socket);
 
       DEBUG("Accepted connection at " << address);
 
@@ -146,11 +211,7 @@ void SocketCommunication::acceptConnection(std::string const &nameAcceptor,
     ERROR("Accepting connection at " << address << " failed: " << e.what());
   }
 
-  // NOTE:
-  // Keep IO service running so that it fires asynchronous handlers from another
-  // thread.
-  _work   = PtrWork(new asio::io_service::work(*_ioService));
-  _thread = std::thread([this]() { _ioService->run(); });
+  startIOThreads();
 }
 
 void SocketCommunication::acceptConnectionAsServer(std::string const &nameAcceptor,
@@ -181,6 +242,10 @@ void SocketCommunication::acceptConnectionAsServer(std::string const &nameAccept
 
       acceptor.open(endpoint.protocol());
       acceptor.set_option(tcp::acceptor::reuse_address(_reuseAddress));
+      if (_receiveBufferSize > 0) {
+        // Set before listening, such that accepted sockets inherit the TCP window.
+        acceptor.set_option(asio::socket_base::receive_buffer_size(_receiveBufferSize));
+      }
       acceptor.bind(endpoint);
       acceptor.listen();
 
@@ -201,6 +266,7 @@ void SocketCommunication::acceptConnectionAsServer(std::string const &nameAccept
       PtrSocket socket = PtrSocket(new Socket(*_ioService));
 
       acceptor.accept(*socket);
+      setSocketOptions(*socket);
       DEBUG("Accepted connection at " << address);
 
       CHECK(_sockets[remoteRank].use_count() == 0,
@@ -221,11 +287,7 @@ void SocketCommunication::acceptConnectionAsServer(std::string const &nameAccept
     ERROR("Accepting connection at " << address << " failed: " << e.what());
   }
 
-  // NOTE:
-  // Keep IO service running so that it fires asynchronous handlers from another
-  // thread.
-  _work   = PtrWork(new asio::io_service::work(*_ioService));
-  _thread = std::thread([this]() { _ioService->run(); });
+  startIOThreads();
 }
 
 void SocketCommunication::requestConnection(std::string const &nameAcceptor,
@@ -281,6 +343,7 @@ void SocketCommunication::requestConnection(std::string const &nameAcceptor,
 
     DEBUG("Requested connection to " << address);
 
+    setSocketOptions(*socket);
     _sockets.push_back(socket);
 
     _rank = requesterProcessRank;
@@ -302,26 +365,36 @@ void SocketCommunication::requestConnection(std::string const &nameAcceptor,
     ERROR("Requesting connection to " << address << " failed: " << e.what());
   }
 
-  // NOTE:
-  // Keep IO service running so that it fires asynchronous handlers from another
-  // thread.
-  _work   = PtrWork(new asio::io_service::work(*_ioService));
-  _thread = std::thread([this]() { _ioService->run(); });
+  startIOThreads();
 }
 
 int SocketCommunication::requestConnectionAsClient(std::string const &nameAcceptor,
                                                    std::string const &nameRequester)
 {
   TRACE(nameAcceptor, nameRequester);
+
+  aRequestConnectionAsClient(nameAcceptor, nameRequester)->wait();
+
+  CHECK(isConnected(), "Requesting connection to " << nameAcceptor << " failed!");
+
+  return _rank;
+}
+
+PtrRequest SocketCommunication::aRequestConnectionAsClient(std::string const &nameAcceptor,
+                                                           std::string const &nameRequester)
+{
+  TRACE(nameAcceptor, nameRequester);
   assertion(not isConnected());
 
   std::string address;
   std::string addressFileName("." + nameRequester + "-" + nameAcceptor + ".address");
 
+  PtrRequest request = SocketRequest::create(_requestPool);
+
   try {
     Publisher::ScopedChangePrefixDirectory scpd(_addressDirectory);
     Publisher p(addressFileName);
-    std::string address = p.read();
+    address = p.read();
     DEBUG("Request connection to " << address);
 
     std::string ipAddress  = address.substr(0, address.find(":"));
@@ -329,73 +402,221 @@ int SocketCommunication::requestConnectionAsClient(std::string const &nameAccept
 
     _portNumber = static_cast<unsigned short>(std::stoi(portNumber));
 
-    PtrSocket socket(new Socket(*_ioService));
+    _sockets.push_back(PtrSocket(new Socket(*_ioService)));
 
+    // Resolve once on the calling thread, only the connection is retried asynchronously.
     using asio::ip::tcp;
-
     tcp::resolver::query query(tcp::v4(), ipAddress, portNumber);
+    tcp::resolver        resolver(*_ioService);
 
-    while (not isConnected()) {
-      tcp::resolver resolver(*_ioService);
-      {
-        tcp::resolver::endpoint_type endpoint = *(resolver.resolve(query));
-        boost::system::error_code    error    = asio::error::host_not_found;
-        socket->connect(endpoint, error);
+    auto attempt      = std::make_shared<ConnectAttempt>();
+    attempt->endpoint = *(resolver.resolve(query));
+    attempt->address  = address;
+    attempt->request  = request;
 
-        _isConnected = not error;
-      }
+    asyncConnect(attempt);
+  } catch (std::exception &e) {
+    ERROR("Requesting connection to " << address << " failed: " << e.what());
+  }
 
-      if (not isConnected()) {
-        // Wait a little, since after a couple of ten-thousand trials the system
-        // seems to get confused and the requester connects wrongly to itself.
-        boost::asio::deadline_timer timer(*_ioService,
-                                          boost::posix_time::milliseconds(1));
-        timer.wait();
+  startIOThreads();
+
+  return request;
+}
+
+void SocketCommunication::asyncConnect(std::shared_ptr<ConnectAttempt> attempt)
+{
+  PtrSocket socket = _sockets.front();
+
+  // Failures are only reported here, the waiting caller checks isConnected()
+  // once the request has completed.
+  auto fail = [this, attempt](std::string const &message) {
+    WARN("Requesting connection to " << attempt->address << " failed: " << message);
+    static_cast<SocketRequest *>(attempt->request.get())->complete();
+  };
+
+  socket->async_connect(attempt->endpoint, [this, socket, attempt, fail](boost::system::error_code const &error) {
+    if (error) {
+      socket->close();
+
+      if (attempt->retries == MAX_CONNECT_RETRIES) {
+        fail(error.message());
+        return;
       }
+
+      // Wait a little, since after a couple of ten-thousand trials the system
+      // seems to get confused and the requester connects wrongly to itself.
+      // The delay doubles with every retry, up to MAX_CONNECT_DELAY.
+      int delay = std::min(1 << std::min(attempt->retries, 10), MAX_CONNECT_DELAY);
+      attempt->retries++;
+
+      auto timer = std::make_shared<asio::deadline_timer>(*_ioService, boost::posix_time::milliseconds(delay));
+      timer->async_wait([this, timer, attempt](boost::system::error_code const &) {
+        asyncConnect(attempt);
+      });
+      return;
     }
 
-    DEBUG("Requested connection to " << address);
+    DEBUG("Requested connection to " << attempt->address);
 
-    _sockets.push_back(socket);
+    setSocketOptions(*socket);
 
-    receive(_rank, 0);
+    // Receive the rank of this requester, as well as rank and size of the acceptor.
+    auto handshake = std::make_shared<std::array<int, 3>>();
+    asio::async_read(*socket, asio::buffer(*handshake),
+                     [this, handshake, attempt, fail](boost::system::error_code const &error, std::size_t) {
+                       if (error) {
+                         fail(error.message());
+                         return;
+                       }
 
-    int remoteSize = 0;
-    int remoteRank = -1;
+                       int remoteRank = (*handshake)[1];
+                       int remoteSize = (*handshake)[2];
 
-    receive(remoteRank, 0);
-    receive(remoteSize, 0);
+                       if (remoteRank != 0 or remoteSize != 1) {
+                         fail("Acceptor has to be a single process of rank 0");
+                         return;
+                       }
 
-    CHECK(remoteRank == 0, "Acceptor base rank has to be 0 but is " << remoteRank << "!");
-    CHECK(remoteSize == 1, "Acceptor communicator size has to be 1!");
+                       _rank                   = (*handshake)[0];
+                       _remoteCommunicatorSize = remoteSize;
+                       _isConnected            = true;
 
-    _remoteCommunicatorSize = remoteSize;
-  } catch (std::exception &e) {
-    ERROR("Requesting connection to " << address << " failed: " << e.what());
+                       static_cast<SocketRequest *>(attempt->request.get())->complete();
+                     });
+  });
+}
+
+std::string SocketCommunication::addressFilePath(std::string const &nameAcceptor,
+                                                 std::string const &nameRequester) const
+{
+  Publisher::ScopedChangePrefixDirectory scpd(_addressDirectory);
+  return Publisher("." + nameRequester + "-" + nameAcceptor + ".address").filePath();
+}
+
+void SocketCommunication::startIOThreads()
+{
+  _channels.clear();
+  for (size_t i = 0; i < _sockets.size(); ++i) {
+    _channels.push_back(std::make_shared<Channel>(*_ioService));
   }
 
   // NOTE:
-  // Keep IO service running so that it fires asynchronous handlers from another
-  // thread.
-  _work   = PtrWork(new asio::io_service::work(*_ioService));
-  _thread = std::thread([this]() { _ioService->run(); });
+  // Keep IO service running so that it fires asynchronous handlers from other
+  // threads.
+  _work = PtrWork(new asio::io_service::work(*_ioService));
+  for (int i = 0; i < _ioThreadCount; ++i) {
+    _threads.emplace_back([this]() { _ioService->run(); });
+  }
+}
 
-  return _rank;
+void SocketCommunication::setSocketOptions(Socket &socket)
+{
+  using asio::ip::tcp;
+
+  boost::system::error_code error;
+
+  socket.set_option(tcp::no_delay(_noDelay), error);
+  if (_sendBufferSize > 0 && not error) {
+    socket.set_option(asio::socket_base::send_buffer_size(_sendBufferSize), error);
+  }
+  if (_receiveBufferSize > 0 && not error) {
+    socket.set_option(asio::socket_base::receive_buffer_size(_receiveBufferSize), error);
+  }
+
+  if (error) {
+    WARN("Setting socket options failed: " << error.message());
+  }
+}
+
+PtrRequest SocketCommunication::asyncWrite(int rank, const void *data, size_t bytes, bool copy)
+{
+  PendingOperation<asio::const_buffer> operation;
+  operation.request = SocketRequest::create(_requestPool);
+
+  // Values passed by value do not outlive the call, hence are sent from a copy.
+  if (copy) {
+    auto bytesBegin = static_cast<const char *>(data);
+    operation.copy  = std::make_shared<std::vector<char>>(bytesBegin, bytesBegin + bytes);
+    data            = operation.copy->data();
+  }
+  operation.buffer = asio::buffer(data, bytes);
+
+  auto channel = _channels[rank];
+  channel->strand.post([this, rank, channel, operation]() {
+    channel->writes.push_back(operation);
+    if (channel->writes.size() == 1) {
+      startWrite(rank);
+    }
+  });
+
+  return operation.request;
+}
+
+PtrRequest SocketCommunication::asyncRead(int rank, void *data, size_t bytes)
+{
+  PendingOperation<asio::mutable_buffer> operation;
+  operation.request = SocketRequest::create(_requestPool);
+  operation.buffer  = asio::buffer(data, bytes);
+
+  auto channel = _channels[rank];
+  channel->strand.post([this, rank, channel, operation]() {
+    channel->reads.push_back(operation);
+    if (channel->reads.size() == 1) {
+      startRead(rank);
+    }
+  });
+
+  return operation.request;
+}
+
+void SocketCommunication::startWrite(int rank)
+{
+  auto channel = _channels[rank];
+
+  asio::async_write(*_sockets[rank], asio::buffer(channel->writes.front().buffer),
+                    channel->strand.wrap([this, rank, channel](boost::system::error_code const &, std::size_t) {
+                      PtrRequest request = channel->writes.front().request;
+                      channel->writes.pop_front();
+                      if (not channel->writes.empty()) {
+                        startWrite(rank);
+                      }
+                      static_cast<SocketRequest *>(request.get())->complete();
+                    }));
+}
+
+void SocketCommunication::startRead(int rank)
+{
+  auto channel = _channels[rank];
+
+  asio::async_read(*_sockets[rank], asio::buffer(channel->reads.front().buffer),
+                   channel->strand.wrap([this, rank, channel](boost::system::error_code const &, std::size_t) {
+                     PtrRequest request = channel->reads.front().request;
+                     channel->reads.pop_front();
+                     if (not channel->reads.empty()) {
+                       startRead(rank);
+                     }
+                     static_cast<SocketRequest *>(request.get())->complete();
+                   }));
 }
 
 void SocketCommunication::closeConnection()
 {
   TRACE();
 
-  if (not isConnected())
-    return;
-
-  if (_thread.joinable()) {
+  // The threads are also running, if an asynchronous connection failed.
+  if (not _threads.empty()) {
     _work.reset();
     _ioService->stop();
-    _thread.join();
+    for (auto &thread : _threads) {
+      thread.join();
+    }
+    _threads.clear();
   }
 
+  if (not isConnected())
+    return;
+
   for (PtrSocket &socket : _sockets) {
     assertion(socket->is_open());
     socket->shutdown(Socket::shutdown_both);
@@ -453,19 +674,7 @@ PtrRequest SocketCommunication::aSend(const int *itemsToSend, int size, int rank
             rankReceiver, _sockets.size());
   assertion(isConnected());
 
-  PtrRequest request(new SocketRequest);
-
-  try {
-    asio::async_write(*_sockets[rankReceiver],
-                      asio::buffer(itemsToSend, size * sizeof(int)),
-                      [request](boost::system::error_code const &, std::size_t) {
-                        static_cast<SocketRequest *>(request.get())->complete();
-                      });
-  } catch (std::exception &e) {
-    ERROR("Send failed: " << e.what());
-  }
-
-  return request;
+  return asyncWrite(rankReceiver, itemsToSend, size * sizeof(int));
 }
 
 void SocketCommunication::send(const double *itemsToSend, int size, int rankReceiver)
@@ -496,19 +705,7 @@ PtrRequest SocketCommunication::aSend(const double *itemsToSend, int size, int r
             rankReceiver, _sockets.size());
   assertion(isConnected());
 
-  PtrRequest request(new SocketRequest);
-
-  try {
-    asio::async_write(*_sockets[rankReceiver],
-                      asio::buffer(itemsToSend, size * sizeof(double)),
-                      [request](boost::system::error_code const &, std::size_t) {
-                        static_cast<SocketRequest *>(request.get())->complete();
-                      });
-  } catch (std::exception &e) {
-    ERROR("Send failed: " << e.what());
-  }
-
-  return request;
+  return asyncWrite(rankReceiver, itemsToSend, size * sizeof(double));
 }
 
 void SocketCommunication::send(double itemToSend, int rankReceiver)
@@ -532,7 +729,16 @@ void SocketCommunication::send(double itemToSend, int rankReceiver)
 
 PtrRequest SocketCommunication::aSend(double itemToSend, int rankReceiver)
 {
-  return aSend(&itemToSend, 1, rankReceiver);
+  TRACE(itemToSend, rankReceiver);
+
+  rankReceiver = rankReceiver - _rankOffset;
+
+  assertion((rankReceiver >= 0) && (rankReceiver < (int) _sockets.size()),
+            rankReceiver,
+            _sockets.size());
+  assertion(isConnected());
+
+  return asyncWrite(rankReceiver, &itemToSend, sizeof(double), true);
 }
 
 void SocketCommunication::send(int itemToSend, int rankReceiver)
@@ -556,7 +762,16 @@ void SocketCommunication::send(int itemToSend, int rankReceiver)
 
 PtrRequest SocketCommunication::aSend(int itemToSend, int rankReceiver)
 {
-  return aSend(&itemToSend, 1, rankReceiver);
+  TRACE(itemToSend, rankReceiver);
+
+  rankReceiver = rankReceiver - _rankOffset;
+
+  assertion((rankReceiver >= 0) && (rankReceiver < (int) _sockets.size()),
+            rankReceiver,
+            _sockets.size());
+  assertion(isConnected());
+
+  return asyncWrite(rankReceiver, &itemToSend, sizeof(int), true);
 }
 
 void SocketCommunication::send(bool itemToSend, int rankReceiver)
@@ -589,19 +804,7 @@ PtrRequest SocketCommunication::aSend(bool itemToSend, int rankReceiver)
             _sockets.size());
   assertion(isConnected());
 
-  PtrRequest request(new SocketRequest);
-
-  try {
-    asio::async_write(*_sockets[rankReceiver],
-                      asio::buffer(&itemToSend, sizeof(bool)),
-                      [request](boost::system::error_code const &, std::size_t) {
-                        static_cast<SocketRequest *>(request.get())->complete();
-                      });
-  } catch (std::exception &e) {
-    ERROR("Send failed: " << e.what());
-  }
-
-  return request;
+  return asyncWrite(rankReceiver, &itemToSend, sizeof(bool), true);
 }
 
 void SocketCommunication::receive(std::string &itemToReceive, int rankSender)
@@ -654,19 +857,7 @@ PtrRequest SocketCommunication::aReceive(int *itemsToReceive, int size, int rank
             _sockets.size());
   assertion(isConnected());
 
-  PtrRequest request(new SocketRequest);
-
-  try {
-    asio::async_read(*_sockets[rankSender],
-                     asio::buffer(itemsToReceive, size * sizeof(int)),
-                     [request](boost::system::error_code const &, std::size_t) {
-                       static_cast<SocketRequest *>(request.get())->complete();
-                     });
-  } catch (std::exception &e) {
-    ERROR("Receive failed: " << e.what());
-  }
-
-  return request;
+  return asyncRead(rankSender, itemsToReceive, size * sizeof(int));
 }
 
 void SocketCommunication::receive(double *itemsToReceive, int size, int rankSender)
@@ -699,19 +890,7 @@ PtrRequest SocketCommunication::aReceive(double *itemsToReceive,
             rankSender, _sockets.size());
   assertion(isConnected());
 
-  PtrRequest request(new SocketRequest);
-
-  try {
-    asio::async_read(*_sockets[rankSender],
-                     asio::buffer(itemsToReceive, size * sizeof(double)),
-                     [request](boost::system::error_code const &, std::size_t) {
-                       static_cast<SocketRequest *>(request.get())->complete();
-                     });
-  } catch (std::exception &e) {
-    ERROR("Receive failed: " << e.what());
-  }
-
-  return request;
+  return asyncRead(rankSender, itemsToReceive, size * sizeof(double));
 }
 
 void SocketCommunication::receive(double &itemToReceive, int rankSender)
@@ -785,19 +964,7 @@ PtrRequest SocketCommunication::aReceive(bool &itemToReceive, int rankSender)
             rankSender, _sockets.size());
   assertion(isConnected());
 
-  PtrRequest request(new SocketRequest);
-
-  try {
-    asio::async_read(*_sockets[rankSender],
-                     asio::buffer(&itemToReceive, sizeof(bool)),
-                     [request](boost::system::error_code const &, std::size_t) {
-                       static_cast<SocketRequest *>(request.get())->complete();
-                     });
-  } catch (std::exception &e) {
-    ERROR("Receive failed: " << e.what());
-  }
-
-  return request;
+  return asyncRead(rankSender, &itemToReceive, sizeof(bool));
 }
 
 void SocketCommunication::send(std::vector<int> const &v, int rankReceiver)
@@ -8,6 +8,7 @@
 #include "logging/Logger.hpp"
 
 #include <thread>
+#include <vector>
 
 namespace boost
 {
@@ -32,14 +33,26 @@ namespace precice
 {
 namespace com
 {
+class SocketRequestPool;
+
 /// Implements Communication by using sockets.
 class SocketCommunication : public Communication
 {
 public:
-  SocketCommunication(unsigned short     portNumber       = 0,
-                      bool               reuseAddress     = false,
-                      std::string const &networkName      = "lo",
-                      std::string const &addressDirectory = ".");
+  /**
+   * @param[in] ioThreadCount Number of threads running asynchronous operations.
+   * @param[in] noDelay Disables Nagle's algorithm (TCP_NODELAY) on all sockets.
+   * @param[in] sendBufferSize Size of the socket send buffers in bytes, 0 keeps the system default.
+   * @param[in] receiveBufferSize Size of the socket receive buffers in bytes, 0 keeps the system default.
+   */
+  SocketCommunication(unsigned short     portNumber        = 0,
+                      bool               reuseAddress      = false,
+                      std::string const &networkName       = "lo",
+                      std::string const &addressDirectory  = ".",
+                      int                ioThreadCount     = 1,
+                      bool               noDelay           = false,
+                      int                sendBufferSize    = 0,
+                      int                receiveBufferSize = 0);
 
   explicit SocketCommunication(std::string const &addressDirectory);
 
@@ -85,6 +98,13 @@ public:
   virtual int requestConnectionAsClient(std::string const &nameAcceptor,
                                         std::string const &nameRequester) override;
 
+  /// Connects asynchronously on the I/O service thread, see Communication::aRequestConnectionAsClient().
+  virtual PtrRequest aRequestConnectionAsClient(std::string const &nameAcceptor,
+                                                std::string const &nameRequester) override;
+
+  virtual std::string addressFilePath(std::string const &nameAcceptor,
+                                      std::string const &nameRequester) const override;
+
   /**
    * @brief Disconnects from communication space, i.e. participant.
    *
@@ -182,26 +202,74 @@ private:
   /// Directory where IP address is exchanged by file.
   std::string _addressDirectory;
 
+  /// Number of threads running the IO service.
+  int _ioThreadCount;
+
+  /// Disables Nagle's algorithm on all sockets.
+  bool _noDelay;
+
+  /// Size of the socket send buffers in bytes, 0 for the system default.
+  int _sendBufferSize;
+
+  /// Size of the socket receive buffers in bytes, 0 for the system default.
+  int _receiveBufferSize;
+
   int _remoteCommunicatorSize = 0;
 
   typedef boost::asio::io_service IOService;
   std::shared_ptr<IOService>      _ioService;
 
+  /// Recycles the memory of the requests of asynchronous operations.
+  std::shared_ptr<SocketRequestPool> _requestPool;
+
   typedef boost::asio::ip::tcp                                 TCP;
   typedef boost::asio::stream_socket_service<TCP>              SocketService;
   typedef boost::asio::basic_stream_socket<TCP, SocketService> Socket;
   typedef std::shared_ptr<Socket>                              PtrSocket;
   std::vector<PtrSocket>                                       _sockets;
 
+  struct Channel;
+
+  /// Queued asynchronous operations of each socket, see Channel.
+  std::vector<std::shared_ptr<Channel>> _channels;
+
   typedef boost::asio::io_service::work Work;
   typedef std::shared_ptr<Work>         PtrWork;
   PtrWork                               _work;
 
-  std::thread _thread;
+  std::vector<std::thread> _threads;
 
   bool isClient();
   bool isServer();
 
+  /// Creates the channels of all sockets and starts the IO service threads.
+  void startIOThreads();
+
+  /// Applies the configured options to a connected socket.
+  void setSocketOptions(Socket &socket);
+
+  /// Writes asynchronously to the socket of the given rank, from a copy of the data if requested.
+  PtrRequest asyncWrite(int rank, const void *data, size_t bytes, bool copy = false);
+
+  /// Reads asynchronously from the socket of the given rank.
+  PtrRequest asyncRead(int rank, void *data, size_t bytes);
+
+  /// Starts the write at the front of the queue of the given rank.
+  void startWrite(int rank);
+
+  /// Starts the read at the front of the queue of the given rank.
+  void startRead(int rank);
+
+  struct ConnectAttempt;
+
+  /**
+   * @brief Connects the client socket to the resolved acceptor endpoint.
+   *
+   * Failed attempts are retried with a growing, bounded delay. Once all retries
+   * failed, the request completes without establishing the connection.
+   */
+  void asyncConnect(std::shared_ptr<ConnectAttempt> attempt);
+
   std::string getIpAddress();
 };
 } // namespace com
@@ -11,11 +11,19 @@ SocketCommunicationFactory::SocketCommunicationFactory(
     unsigned short     portNumber,
     bool               reuseAddress,
     std::string const &networkName,
-    std::string const &addressDirectory)
+    std::string const &addressDirectory,
+    int                ioThreadCount,
+    bool               noDelay,
+    int                sendBufferSize,
+    int                receiveBufferSize)
     : _portNumber(portNumber),
       _reuseAddress(reuseAddress),
       _networkName(networkName),
-      _addressDirectory(addressDirectory)
+      _addressDirectory(addressDirectory),
+      _ioThreadCount(ioThreadCount),
+      _noDelay(noDelay),
+      _sendBufferSize(sendBufferSize),
+      _receiveBufferSize(receiveBufferSize)
 {
   if (_addressDirectory.empty()) {
     _addressDirectory = ".";
@@ -31,7 +39,8 @@ SocketCommunicationFactory::SocketCommunicationFactory(
 PtrCommunication SocketCommunicationFactory::newCommunication()
 {
   return std::make_shared<SocketCommunication>(
-      _portNumber, _reuseAddress, _networkName, _addressDirectory);
+      _portNumber, _reuseAddress, _networkName, _addressDirectory,
+      _ioThreadCount, _noDelay, _sendBufferSize, _receiveBufferSize);
 }
 
 std::string SocketCommunicationFactory::addressDirectory()
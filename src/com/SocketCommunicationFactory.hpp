@@ -14,10 +14,15 @@ namespace com
 class SocketCommunicationFactory : public CommunicationFactory
 {
 public:
-  SocketCommunicationFactory(unsigned short     portNumber       = 0,
-                             bool               reuseAddress     = false,
-                             std::string const &networkName      = "lo",
-                             std::string const &addressDirectory = ".");
+  /// See SocketCommunication::SocketCommunication() for the parameters.
+  SocketCommunicationFactory(unsigned short     portNumber        = 0,
+                             bool               reuseAddress      = false,
+                             std::string const &networkName       = "lo",
+                             std::string const &addressDirectory  = ".",
+                             int                ioThreadCount     = 1,
+                             bool               noDelay           = false,
+                             int                sendBufferSize    = 0,
+                             int                receiveBufferSize = 0);
 
   explicit SocketCommunicationFactory(std::string const &addressDirectory);
 
@@ -30,6 +35,10 @@ private:
   bool           _reuseAddress;
   std::string    _networkName;
   std::string    _addressDirectory;
+  int            _ioThreadCount;
+  bool           _noDelay;
+  int            _sendBufferSize;
+  int            _receiveBufferSize;
 };
 } // namespace com
 } // namespace precice
@@ -1,37 +1,140 @@
+#ifndef PRECICE_NO_SOCKETS
+
 #include "SocketRequest.hpp"
 
+#include <new>
+
 namespace precice
 {
 namespace com
 {
-SocketRequest::SocketRequest()
-    : _complete(false)
+namespace
 {
-}
 
-void SocketRequest::complete()
+/**
+ * @brief Allocator, which takes its memory from a SocketRequestPool.
+ *
+ * Used with std::allocate_shared, such that a request and its shared state are
+ * allocated as one block. The shared state holds a copy of the allocator,
+ * which keeps the pool alive until the request has been released.
+ */
+template <typename T>
+class PoolAllocator
 {
+public:
+  using value_type = T;
+
+  explicit PoolAllocator(std::shared_ptr<SocketRequestPool> const &pool)
+      : pool(pool)
   {
-    std::lock_guard<std::mutex> lock(_completeMutex);
+  }
 
-    _complete = true;
+  template <typename U>
+  PoolAllocator(PoolAllocator<U> const &other)
+      : pool(other.pool)
+  {
+  }
+
+  T *allocate(std::size_t n)
+  {
+    return static_cast<T *>(pool->allocate(n * sizeof(T)));
+  }
+
+  void deallocate(T *p, std::size_t n)
+  {
+    pool->deallocate(p, n * sizeof(T));
   }
 
-  _completeCondition.notify_one();
+  std::shared_ptr<SocketRequestPool> pool;
+};
+
+template <typename T, typename U>
+bool operator==(PoolAllocator<T> const &lhs, PoolAllocator<U> const &rhs)
+{
+  return lhs.pool == rhs.pool;
 }
 
-bool SocketRequest::test()
+template <typename T, typename U>
+bool operator!=(PoolAllocator<T> const &lhs, PoolAllocator<U> const &rhs)
+{
+  return lhs.pool != rhs.pool;
+}
+
+} // namespace
+
+SocketRequestPool::~SocketRequestPool()
 {
-  std::lock_guard<std::mutex> lock(_completeMutex);
+  Block *blocks[] = {_available, _released.exchange(nullptr)};
 
-  return _complete;
+  for (Block *block : blocks) {
+    while (block) {
+      Block *next = block->next;
+      ::operator delete(block);
+      block = next;
+    }
+  }
 }
 
-void SocketRequest::wait()
+void *SocketRequestPool::allocate(std::size_t bytes)
 {
-  std::unique_lock<std::mutex> lock(_completeMutex);
+  if (_blockSize == 0 and bytes >= sizeof(Block)) {
+    _blockSize = bytes;
+  }
 
-  _completeCondition.wait(lock, [this] { return _complete; });
+  if (bytes != _blockSize) {
+    return ::operator new(bytes);
+  }
+
+  if (not _available) {
+    // Taking over the whole stack cannot suffer from the ABA problem of popping single blocks.
+    _available = _released.exchange(nullptr, std::memory_order_acquire);
+  }
+
+  if (not _available) {
+    return ::operator new(bytes);
+  }
+
+  Block *block = _available;
+  _available   = block->next;
+  return block;
+}
+
+void SocketRequestPool::deallocate(void *p, std::size_t bytes)
+{
+  if (bytes != _blockSize) {
+    ::operator delete(p);
+    return;
+  }
+
+  Block *block = new (p) Block;
+  block->next  = _released.load(std::memory_order_relaxed);
+  while (not _released.compare_exchange_weak(block->next, block,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+  }
+}
+
+PtrRequest SocketRequest::create(std::shared_ptr<SocketRequestPool> const &pool)
+{
+  return std::allocate_shared<SocketRequest>(PoolAllocator<SocketRequest>(pool));
+}
+
+void SocketRequest::complete()
+{
+  _complete.store(true);
+  notifyCompletion();
+}
+
+bool SocketRequest::test()
+{
+  return _complete.load();
+}
+
+void SocketRequest::wait()
+{
+  waitUntil([this] { return _complete.load(); });
 }
 } // namespace com
 } // namespace precice
+
+#endif // not PRECICE_NO_SOCKETS
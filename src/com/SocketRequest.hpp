@@ -3,17 +3,65 @@
 
 #include "Request.hpp"
 
-#include <condition_variable>
-#include <mutex>
+#include <atomic>
+#include <cstddef>
+#include <memory>
 
 namespace precice
 {
 namespace com
 {
+/**
+ * @brief Recycles the memory of released socket requests.
+ *
+ * Owned by a SocketCommunication and by all requests created through it, such
+ * that the memory is freed once the communication and its last request are
+ * gone. Requests are created by the thread using the communication, but may be
+ * released by the I/O service threads. Released blocks are pushed onto a
+ * lock-free stack, which the creating thread takes over as a whole once its own
+ * blocks are used up.
+ */
+class SocketRequestPool
+{
+public:
+  SocketRequestPool() = default;
+
+  SocketRequestPool(SocketRequestPool const &) = delete;
+  SocketRequestPool &operator=(SocketRequestPool const &) = delete;
+
+  ~SocketRequestPool();
+
+  void *allocate(std::size_t bytes);
+
+  void deallocate(void *p, std::size_t bytes);
+
+private:
+  struct Block {
+    Block *next;
+  };
+
+  /// Size of the recycled blocks, set by the first allocation.
+  std::size_t _blockSize = 0;
+
+  /// Blocks available to the creating thread.
+  Block *_available = nullptr;
+
+  /// Blocks released by any thread.
+  std::atomic<Block *> _released{nullptr};
+};
+
+/**
+ * @brief Request of an asynchronous socket operation.
+ *
+ * The request is completed by the I/O service thread of SocketCommunication.
+ * Completion is signalled through an atomic flag, waiting threads only block
+ * once spinning did not suffice, see Request::waitUntil().
+ */
 class SocketRequest : public Request
 {
 public:
-  SocketRequest();
+  /// Returns a new request, which reuses the memory of requests released to the pool.
+  static PtrRequest create(std::shared_ptr<SocketRequestPool> const &pool);
 
   void complete();
 
@@ -22,10 +70,7 @@ public:
   void wait();
 
 private:
-  bool _complete;
-
-  std::condition_variable _completeCondition;
-  std::mutex              _completeMutex;
+  std::atomic<bool> _complete{false};
 };
 } // namespace com
 } // namespace precice
@@ -1,7 +1,9 @@
 #include "CommunicationConfiguration.hpp"
 #include "com/MPIDirectCommunication.hpp"
 #include "com/MPIPortsCommunication.hpp"
+#include "com/MPIPortsCommunicationFactory.hpp"
 #include "com/SocketCommunication.hpp"
+#include "com/SocketCommunicationFactory.hpp"
 #include "xml/XMLAttribute.hpp"
 #include "utils/Helpers.hpp"
 
@@ -49,5 +51,24 @@ PtrCommunication CommunicationConfiguration::createCommunication(
   return com;
 }
 
+PtrCommunicationFactory CommunicationConfiguration::createCommunicationFactory(
+    const xml::XMLTag &tag) const
+{
+  com::PtrCommunicationFactory factory;
+  if (tag.getName() == "sockets") {
+    // The configured port is taken by the connection created by createCommunication().
+    std::string network = tag.getStringAttributeValue("network");
+    std::string dir     = tag.getStringAttributeValue("exchange-directory");
+    factory             = std::make_shared<com::SocketCommunicationFactory>(0, false, network, dir);
+  }
+#ifndef PRECICE_NO_MPI
+  else if (tag.getName() == "mpi") {
+    std::string dir = tag.getStringAttributeValue("exchange-directory");
+    factory         = std::make_shared<com::MPIPortsCommunicationFactory>(dir);
+  }
+#endif
+  return factory;
+}
+
 } // namespace com
 } // namespace precice
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "com/SharedPointer.hpp"
 #include "logging/Logger.hpp"
 #include "xml/XMLTag.hpp"
 
@@ -20,6 +21,13 @@ public:
   /// Returns a communication object of given type.
   PtrCommunication createCommunication(const xml::XMLTag &tag) const;
 
+  /**
+   * @brief Returns a factory for further connections of given type, e.g. for Communication::connectTree().
+   *
+   * Returns nullptr for "mpi-single", which has native collectives and needs no further connections.
+   */
+  PtrCommunicationFactory createCommunicationFactory(const xml::XMLTag &tag) const;
+
 private:
   mutable logging::Logger _log{"com::CommunicationConfiguration"};
 };
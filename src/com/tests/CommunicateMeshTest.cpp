@@ -5,6 +5,7 @@
 #include "mesh/Edge.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/PropertyContainer.hpp"
+#include "mesh/Triangle.hpp"
 #include "mesh/Vertex.hpp"
 #include "testing/Testing.hpp"
 #include "utils/Parallel.hpp"
@@ -34,9 +35,17 @@ BOOST_AUTO_TEST_CASE(twoSolvers,
       mesh::Vertex &v1 = mesh.createVertex(Eigen::VectorXd::Constant(dim, 1));
       mesh::Vertex &v2 = mesh.createVertex(Eigen::VectorXd::Constant(dim, 2));
 
-      mesh.createEdge(v0, v1);
-      mesh.createEdge(v1, v2);
-      mesh.createEdge(v2, v0);
+      v0.setGlobalIndex(10);
+      v1.setGlobalIndex(5);
+      v2.setGlobalIndex(1000000);
+
+      mesh::Edge &e0 = mesh.createEdge(v0, v1);
+      mesh::Edge &e1 = mesh.createEdge(v1, v2);
+      mesh::Edge &e2 = mesh.createEdge(v2, v0);
+
+      if (dim == 3) {
+        mesh.createTriangle(e0, e1, e2);
+      }
     }
 
     // Create mesh communicator
@@ -68,6 +77,9 @@ BOOST_AUTO_TEST_CASE(twoSolvers,
         BOOST_TEST(testing::equals(mesh.vertices()[1].getCoords(), Eigen::VectorXd::Constant(dim, 0)));
         BOOST_TEST(testing::equals(mesh.vertices()[2].getCoords(), Eigen::VectorXd::Constant(dim, 1)));
         BOOST_TEST(testing::equals(mesh.vertices()[3].getCoords(), Eigen::VectorXd::Constant(dim, 2)));
+        BOOST_TEST(mesh.vertices()[1].getGlobalIndex() == 10);
+        BOOST_TEST(mesh.vertices()[2].getGlobalIndex() == 5);
+        BOOST_TEST(mesh.vertices()[3].getGlobalIndex() == 1000000);
       }
       com->closeConnection();
 
@@ -77,6 +89,12 @@ BOOST_AUTO_TEST_CASE(twoSolvers,
       BOOST_TEST(testing::equals(mesh.edges()[1].vertex(1).getCoords(), Eigen::VectorXd::Constant(dim, 2)));
       BOOST_TEST(testing::equals(mesh.edges()[2].vertex(0).getCoords(), Eigen::VectorXd::Constant(dim, 2)));
       BOOST_TEST(testing::equals(mesh.edges()[2].vertex(1).getCoords(), Eigen::VectorXd::Constant(dim, 0)));
+      if (dim == 3) {
+        BOOST_TEST(mesh.triangles().size() == 1);
+        BOOST_TEST(&mesh.triangles()[0].edge(0) == &mesh.edges()[0]);
+        BOOST_TEST(&mesh.triangles()[0].edge(1) == &mesh.edges()[1]);
+        BOOST_TEST(&mesh.triangles()[0].edge(2) == &mesh.edges()[2]);
+      }
       utils::Parallel::clearGroups();
       utils::Parallel::setGlobalCommunicator(utils::Parallel::getCommunicatorWorld());
     }
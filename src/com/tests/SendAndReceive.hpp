@@ -138,9 +138,45 @@ void TestSendAndReceiveVectors()
   }
 }
 
+template<typename T>
+void TestWaitAny()
+{
+  T com;
+  if (utils::Parallel::getProcessRank() == 0) {
+    com.acceptConnection("process0", "process1");
+    {
+      std::vector<double>     msg(3, 0.0);
+      std::vector<com::PtrRequest> requests;
+      for (auto &item : msg) {
+        requests.push_back(com.aReceive(&item, 1, 0));
+      }
+      int completed = com::Request::testSome(requests).size();
+      while (com::Request::waitAny(requests) != -1) {
+        completed++;
+      }
+      BOOST_TEST(completed == 3);
+      for (auto const &request : requests) {
+        BOOST_TEST(not request);
+      }
+      BOOST_TEST(msg == std::vector<double>({1.0, 2.0, 3.0}));
+    }
+    com.closeConnection();
+  } else if (utils::Parallel::getProcessRank() == 1) {
+    com.requestConnection("process0", "process1", 0, 1);
+    {
+      std::vector<double> msg{1.0, 2.0, 3.0};
+      for (auto item : msg) {
+        com.send(item, 0);
+      }
+    }
+    com.closeConnection();
+  }
+}
+
 template<typename T>
 void TestSendAndReceive()
 {
   TestSendAndReceivePrimitiveTypes<T>();
   TestSendAndReceiveVectors<T>(); 
+  TestWaitAny<T>();
 }
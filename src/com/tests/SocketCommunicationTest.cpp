@@ -1,4 +1,6 @@
+#include "com/Request.hpp"
 #include "com/SocketCommunication.hpp"
+#include "com/SocketCommunicationFactory.hpp"
 #include "testing/Testing.hpp"
 #include "SendAndReceive.hpp"
 
@@ -19,5 +21,112 @@ BOOST_AUTO_TEST_CASE(SendAndReceive,
   TestSendAndReceive<SocketCommunication>();
 }
 
+BOOST_AUTO_TEST_CASE(MultipleIOThreads,
+                     * testing::MinRanks(2))
+{
+  SocketCommunication com(0, false, "lo", ".", 4, true, 1 << 20, 1 << 20);
+  int                 size = 100;
+
+  if (utils::Parallel::getProcessRank() == 0) {
+    com.acceptConnection("process0", "process1");
+    // Large messages in between the small ones would interleave on the socket,
+    // if writes were not queued.
+    std::vector<PtrRequest>          requests;
+    std::vector<std::vector<double>> values;
+    for (int i = 0; i < size; ++i) {
+      values.emplace_back(size * size, i);
+    }
+    for (int i = 0; i < size; ++i) {
+      requests.push_back(com.aSend(i, 0));
+      requests.push_back(com.aSend(values[i].data(), values[i].size(), 0));
+    }
+    Request::wait(requests);
+    com.closeConnection();
+  } else if (utils::Parallel::getProcessRank() == 1) {
+    com.requestConnection("process0", "process1", 0, 1);
+    std::vector<PtrRequest>          requests;
+    std::vector<int>                 items(size, -1);
+    std::vector<std::vector<double>> values(size, std::vector<double>(size * size, -1.0));
+    for (int i = 0; i < size; ++i) {
+      requests.push_back(com.aReceive(items[i], 0));
+      requests.push_back(com.aReceive(values[i].data(), values[i].size(), 0));
+    }
+    Request::wait(requests);
+    for (int i = 0; i < size; ++i) {
+      BOOST_TEST(items[i] == i);
+      BOOST_TEST(values[i] == std::vector<double>(size * size, i));
+    }
+    com.closeConnection();
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TreeCollectives,
+                     * testing::OnSize(4))
+{
+  SocketCommunication        com;
+  SocketCommunicationFactory factory;
+  int                        rank = utils::Parallel::getProcessRank();
+
+  if (rank == 0) {
+    com.acceptConnection("Master", "Slaves");
+    com.setRankOffset(1);
+  } else {
+    com.requestConnection("Master", "Slaves", rank - 1, 3);
+  }
+  // Rank 0 is the parent of ranks 1 and 2, rank 2 is the parent of rank 3.
+  com.connectTree(factory, "Tree", rank, 4);
+
+  std::vector<double> items{1.0 * rank, 2.0 * rank};
+  std::vector<double> sum(2, 0.0);
+  int                 count = 0;
+  std::vector<int>    values;
+  if (rank == 0) {
+    com.allreduceSum(items.data(), sum.data(), 2);
+    com.reduceSum(1, count);
+    BOOST_TEST(count == 4);
+    values = {3, 1, 4};
+    com.broadcast(values);
+  } else {
+    com.allreduceSum(items.data(), sum.data(), 2, 0);
+    com.reduceSum(1, count, 0);
+    com.broadcast(values, 0);
+  }
+  BOOST_TEST(sum == std::vector<double>({6.0, 12.0}));
+  BOOST_TEST(values == std::vector<int>({3, 1, 4}));
+
+  com.closeTree();
+  com.closeConnection();
+}
+
+BOOST_AUTO_TEST_CASE(RingConnection,
+                     * testing::OnSize(4))
+{
+  SocketCommunication        com;
+  SocketCommunicationFactory factory;
+  int                        rank = utils::Parallel::getProcessRank();
+
+  if (rank == 0) {
+    com.acceptConnection("Master", "Slaves");
+    com.setRankOffset(1);
+  } else {
+    com.requestConnection("Master", "Slaves", rank - 1, 3);
+  }
+  com.connectRing(factory, "Ring", rank, 4);
+
+  // hand the own rank around the whole ring
+  int message = rank;
+  for (int cycle = 1; cycle < 4; cycle++) {
+    int received = -1;
+    auto request = com.getRingRight()->aSend(&message, 1, 0);
+    com.getRingLeft()->receive(received, 0);
+    request->wait();
+    BOOST_TEST(received == (rank + 4 - cycle) % 4);
+    message = received;
+  }
+
+  com.closeRing();
+  com.closeConnection();
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Socket
 BOOST_AUTO_TEST_SUITE_END() // Communication
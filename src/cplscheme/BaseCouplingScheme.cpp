@@ -5,6 +5,7 @@
 #include "com/Communication.hpp"
 #include "com/SharedPointer.hpp"
 #include "impl/ConvergenceMeasure.hpp"
+#include "impl/NormBatch.hpp"
 #include "impl/PostProcessing.hpp"
 #include "io/TXTReader.hpp"
 #include "io/TXTWriter.hpp"
@@ -145,14 +146,16 @@ void BaseCouplingScheme::sendDt()
 }
 
 void BaseCouplingScheme::addDataToSend(
-    mesh::PtrData data,
-    mesh::PtrMesh mesh,
-    bool          initialize)
+    mesh::PtrData      data,
+    mesh::PtrMesh      mesh,
+    bool               initialize,
+    m2n::PtrCompressor compressor)
 {
   TRACE();
   int id = data->getID();
   if (!utils::contained(id, _sendData)) {
     PtrCouplingData     ptrCplData(new CouplingData(&(data->values()), mesh, initialize, data->getDimensions()));
+    ptrCplData->compressor = compressor;
     DataMap::value_type pair = std::make_pair(id, ptrCplData);
     _sendData.insert(pair);
   } else {
@@ -162,14 +165,16 @@ void BaseCouplingScheme::addDataToSend(
 }
 
 void BaseCouplingScheme::addDataToReceive(
-    mesh::PtrData data,
-    mesh::PtrMesh mesh,
-    bool          initialize)
+    mesh::PtrData      data,
+    mesh::PtrMesh      mesh,
+    bool               initialize,
+    m2n::PtrCompressor compressor)
 {
   TRACE();
   int id = data->getID();
   if (!utils::contained(id, _receiveData)) {
     PtrCouplingData     ptrCplData(new CouplingData(&(data->values()), mesh, initialize, data->getDimensions()));
+    ptrCplData->compressor = compressor;
     DataMap::value_type pair = std::make_pair(id, ptrCplData);
     _receiveData.insert(pair);
   } else {
@@ -249,7 +254,8 @@ std::vector<int> BaseCouplingScheme::sendData(m2n::PtrM2N m2n)
   for (const DataMap::value_type &pair : _sendData) {
     //std::cout<<"\nsend data id="<<pair.first<<": "<<*(pair.second->values)<<std::endl;
     int size = pair.second->values->size();
-    m2n->send(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
+    m2n->send(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension,
+              pair.second->compressor.get());
     sentDataIDs.push_back(pair.first);
   }
   DEBUG("Number of sent data sets = " << sentDataIDs.size());
@@ -267,7 +273,8 @@ std::vector<int> BaseCouplingScheme::receiveData(
   for (DataMap::value_type &pair : _receiveData) {
     int size = pair.second->values->size();
     //std::cout<<"\nreceive data id="<<pair.first<<": "<<*(pair.second->values)<<std::endl;
-    m2n->receive(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
+    m2n->receive(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension,
+                 pair.second->compressor.get());
     receivedDataIDs.push_back(pair.first);
   }
   DEBUG("Number of received data sets = " << receivedDataIDs.size());
@@ -653,8 +660,9 @@ bool BaseCouplingScheme::measureConvergence(
     _convergenceWriter->writeData("Timestep", _timesteps);
     _convergenceWriter->writeData("Iteration", _iterations);
   }
-  for (size_t i = 0; i < _convergenceMeasures.size(); i++) {
-    ConvergenceMeasure &convMeasure = _convergenceMeasures[i];
+  // all measures share one global reduction of their norms
+  impl::NormBatch batch;
+  for (ConvergenceMeasure &convMeasure : _convergenceMeasures) {
 
     // only apply convergence measures for fine model optimization, i.e., coupling
     if (convMeasure.level > 0)
@@ -667,7 +675,17 @@ bool BaseCouplingScheme::measureConvergence(
     if (designSpecifications.find(convMeasure.dataID) != designSpecifications.end())
       q = designSpecifications.at(convMeasure.dataID);
 
-    convMeasure.measure->measure(oldValues, *convMeasure.data->values, q);
+    convMeasure.measure->addNorms(oldValues, *convMeasure.data->values, q, batch);
+  }
+  batch.reduce();
+
+  for (size_t i = 0; i < _convergenceMeasures.size(); i++) {
+    ConvergenceMeasure &convMeasure = _convergenceMeasures[i];
+
+    if (convMeasure.level > 0)
+      continue;
+
+    convMeasure.measure->evaluate(batch);
 
     if (not utils::MasterSlave::_slaveMode) {
       std::stringstream sstm;
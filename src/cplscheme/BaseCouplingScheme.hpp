@@ -83,15 +83,17 @@ public:
 
   /// Adds data to be sent on data exchange and possibly be modified during coupling iterations.
   void addDataToSend(
-      mesh::PtrData data,
-      mesh::PtrMesh mesh,
-      bool          initialize);
+      mesh::PtrData      data,
+      mesh::PtrMesh      mesh,
+      bool               initialize,
+      m2n::PtrCompressor compressor = nullptr);
 
   /// Adds data to be received on data exchange.
   void addDataToReceive(
-      mesh::PtrData data,
-      mesh::PtrMesh mesh,
-      bool          initialize);
+      mesh::PtrData      data,
+      mesh::PtrMesh      mesh,
+      bool               initialize,
+      m2n::PtrCompressor compressor = nullptr);
 
   /// Returns true, if initialize has been called.
   virtual bool isInitialized() const
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "m2n/SharedPointer.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "utils/assertion.hpp"
 #include "mesh/Data.hpp"
@@ -27,6 +28,9 @@ struct CouplingData
   /// dimension of one data value (scalar=1, or vectorial=interface-dimension)
   int dimension;
 
+  /// Compressor of the exchanged values, or nullptr if they are exchanged uncompressed.
+  m2n::PtrCompressor compressor;
+
   /**
    * @brief Default constructor, not to be used!
    *
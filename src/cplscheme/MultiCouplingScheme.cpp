@@ -223,14 +223,16 @@ void MultiCouplingScheme::mergeData()
 
 void MultiCouplingScheme:: addDataToSend
 (
-  mesh::PtrData data,
-  mesh::PtrMesh mesh,
-  bool          initialize,
-  int           index)
+  mesh::PtrData      data,
+  mesh::PtrMesh      mesh,
+  bool               initialize,
+  int                index,
+  m2n::PtrCompressor compressor)
 {
   int id = data->getID();
   if(! utils::contained(id, _sendDataVector[index])) {
     PtrCouplingData ptrCplData (new CouplingData(& (data->values()), mesh, initialize, data->getDimensions()));
+    ptrCplData->compressor = compressor;
     DataMap::value_type pair = std::make_pair (id, ptrCplData);
     _sendDataVector[index].insert(pair);
   }
@@ -243,14 +245,16 @@ void MultiCouplingScheme:: addDataToSend
 
 void MultiCouplingScheme:: addDataToReceive
 (
-  mesh::PtrData data,
-  mesh::PtrMesh mesh,
-  bool          initialize,
-  int           index)
+  mesh::PtrData      data,
+  mesh::PtrMesh      mesh,
+  bool               initialize,
+  int                index,
+  m2n::PtrCompressor compressor)
 {
   int id = data->getID();
   if(! utils::contained(id, _receiveDataVector[index])) {
     PtrCouplingData ptrCplData (new CouplingData(& (data->values()), mesh, initialize, data->getDimensions()));
+    ptrCplData->compressor = compressor;
     DataMap::value_type pair = std::make_pair (id, ptrCplData);
     _receiveDataVector[index].insert(pair);
   }
@@ -272,7 +276,8 @@ void MultiCouplingScheme:: sendData()
     for (DataMap::value_type& pair : _sendDataVector[i]) {
       int size = pair.second->values->size();
       if (size > 0) {
-        _communications[i]->send(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
+        _communications[i]->send(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension,
+                                 pair.second->compressor.get());
       }
     }
   }
@@ -289,7 +294,8 @@ void MultiCouplingScheme:: receiveData()
     for (DataMap::value_type& pair : _receiveDataVector[i]) {
       int size = pair.second->values->size();
       if (size > 0) {
-        _communications[i]->receive(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
+        _communications[i]->receive(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension,
+                                    pair.second->compressor.get());
       }
     }
   }
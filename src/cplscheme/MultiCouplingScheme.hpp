@@ -30,17 +30,19 @@ public:
 
   /// Adds data to be sent on data exchange and possibly be modified during coupling iterations.
   void addDataToSend (
-    mesh::PtrData data,
-    mesh::PtrMesh mesh,
-    bool          initialize,
-    int           index);
+    mesh::PtrData      data,
+    mesh::PtrMesh      mesh,
+    bool               initialize,
+    int                index,
+    m2n::PtrCompressor compressor = nullptr);
 
   /// Adds data to be received on data exchange.
   void addDataToReceive (
-    mesh::PtrData data,
-    mesh::PtrMesh mesh,
-    bool          initialize,
-    int           index);
+    mesh::PtrData      data,
+    mesh::PtrMesh      mesh,
+    bool               initialize,
+    int                index,
+    m2n::PtrCompressor compressor = nullptr);
 
 protected:
   /// merges send and receive data into one map (for parallel post-processing)
@@ -11,6 +11,7 @@
 #include "cplscheme/impl/PostProcessing.hpp"
 #include "cplscheme/impl/RelativeConvergenceMeasure.hpp"
 #include "cplscheme/impl/ResidualRelativeConvergenceMeasure.hpp"
+#include "m2n/Compressor.hpp"
 #include "m2n/M2N.hpp"
 #include "m2n/config/M2NConfiguration.hpp"
 #include "mesh/config/DataConfiguration.hpp"
@@ -69,6 +70,8 @@ CouplingSchemeConfiguration::CouplingSchemeConfiguration(
       ATTR_SUFFICES("suffices"),
       ATTR_CONTROL("control"),
       ATTR_LEVEL("level"),
+      ATTR_COMPRESSION("compression"),
+      ATTR_COMPRESSION_TOLERANCE("compression-tolerance"),
       VALUE_SERIAL_EXPLICIT("serial-explicit"),
       VALUE_PARALLEL_EXPLICIT("parallel-explicit"),
       VALUE_SERIAL_IMPLICIT("serial-implicit"),
@@ -76,6 +79,11 @@ CouplingSchemeConfiguration::CouplingSchemeConfiguration(
       VALUE_MULTI("multi"),
       VALUE_FIXED("fixed"),
       VALUE_FIRST_PARTICIPANT("first-participant"),
+      VALUE_NONE("none"),
+      VALUE_LOSSLESS("lossless"),
+      VALUE_DELTA("delta"),
+      VALUE_LOSSY("lossy"),
+      VALUE_SPARSE("sparse"),
       _config(),
       _meshConfig(meshConfig),
       _m2nConfig(m2nConfig),
@@ -222,6 +230,8 @@ void CouplingSchemeConfiguration::xmlTagCallback(
     std::string   nameParticipantFrom = tag.getStringAttributeValue(ATTR_FROM);
     std::string   nameParticipantTo   = tag.getStringAttributeValue(ATTR_TO);
     bool          initialize          = tag.getBooleanAttributeValue(ATTR_INITIALIZE);
+    std::string   compression         = tag.getStringAttributeValue(ATTR_COMPRESSION);
+    double        tolerance           = tag.getDoubleAttributeValue(ATTR_COMPRESSION_TOLERANCE);
     mesh::PtrData exchangeData;
     mesh::PtrMesh exchangeMesh;
     for (mesh::PtrMesh mesh : _meshConfig->meshes()) {
@@ -241,10 +251,26 @@ void CouplingSchemeConfiguration::xmlTagCallback(
              << "\" not defined at definition of coupling scheme";
       throw stream.str();
     }
+    m2n::PtrCompressor compressor;
+    if (compression == VALUE_LOSSLESS) {
+      compressor = std::make_shared<m2n::Compressor>(nameData, m2n::Compressor::Mode::LOSSLESS);
+    } else if (compression == VALUE_DELTA) {
+      compressor = std::make_shared<m2n::Compressor>(nameData, m2n::Compressor::Mode::DELTA);
+    } else if (compression == VALUE_LOSSY) {
+      CHECK(tolerance > 0.0 && tolerance < 1.0,
+            "Lossy compression of data \"" << nameData << "\" requires a "
+                                            << ATTR_COMPRESSION_TOLERANCE << " between 0 and 1!");
+      compressor = std::make_shared<m2n::Compressor>(nameData, m2n::Compressor::Mode::LOSSY, tolerance);
+    } else if (compression == VALUE_SPARSE) {
+      CHECK(tolerance >= 0.0,
+            "Sparse exchange of data \"" << nameData << "\" requires a non-negative "
+                                          << ATTR_COMPRESSION_TOLERANCE << "!");
+      compressor = std::make_shared<m2n::Compressor>(nameData, m2n::Compressor::Mode::SPARSE, tolerance);
+    }
     _meshConfig->addNeededMesh(nameParticipantFrom, nameMesh);
     _meshConfig->addNeededMesh(nameParticipantTo, nameMesh);
     _config.exchanges.push_back(std::make_tuple(exchangeData, exchangeMesh,
-                                                nameParticipantFrom, nameParticipantTo, initialize));
+                                                nameParticipantFrom, nameParticipantTo, initialize, compressor));
   } else if (tag.getName() == TAG_MAX_ITERATIONS) {
     assertion(_config.type == VALUE_SERIAL_IMPLICIT || _config.type == VALUE_PARALLEL_IMPLICIT || _config.type == VALUE_MULTI);
     _config.maxIterations = tag.getIntAttributeValue(ATTR_VALUE);
@@ -465,6 +491,24 @@ void CouplingSchemeConfiguration::addTagExchange(
   XMLAttribute<bool> attrInitialize(ATTR_INITIALIZE);
   attrInitialize.setDefaultValue(false);
   tagExchange.addAttribute(attrInitialize);
+  XMLAttribute<std::string> attrCompression(ATTR_COMPRESSION);
+  attrCompression.setDocumentation(
+      "Compression of the exchanged values: \"none\", \"lossless\" (byte shuffling and run-length "
+      "encoding), \"delta\" (lossless, relative to the values exchanged last), \"lossy\" "
+      "(delta with a relative tolerance, see " + ATTR_COMPRESSION_TOLERANCE + "), or \"sparse\" "
+      "(only values, which changed by more than the relative tolerance since the last exchange).");
+  ValidatorEquals<std::string> validNone(VALUE_NONE);
+  ValidatorEquals<std::string> validLossless(VALUE_LOSSLESS);
+  ValidatorEquals<std::string> validDelta(VALUE_DELTA);
+  ValidatorEquals<std::string> validLossy(VALUE_LOSSY);
+  ValidatorEquals<std::string> validSparse(VALUE_SPARSE);
+  attrCompression.setValidator(validNone || validLossless || validDelta || validLossy || validSparse);
+  attrCompression.setDefaultValue(VALUE_NONE);
+  tagExchange.addAttribute(attrCompression);
+  XMLAttribute<double> attrCompressionTolerance(ATTR_COMPRESSION_TOLERANCE);
+  attrCompressionTolerance.setDocumentation("Relative tolerance of lossy compression and sparse exchange.");
+  attrCompressionTolerance.setDefaultValue(0.0);
+  tagExchange.addAttribute(attrCompressionTolerance);
   tag.addSubtag(tagExchange);
 }
 
@@ -855,9 +899,9 @@ void CouplingSchemeConfiguration::addDataToBeExchanged(
 
     bool initialize = get<4>(tuple);
     if (from == accessor) {
-      scheme.addDataToSend(data, mesh, initialize);
+      scheme.addDataToSend(data, mesh, initialize, get<5>(tuple));
     } else if (to == accessor) {
-      scheme.addDataToReceive(data, mesh, initialize);
+      scheme.addDataToReceive(data, mesh, initialize, get<5>(tuple));
     } else {
       assertion(_config.type == VALUE_MULTI);
     }
@@ -895,7 +939,7 @@ void CouplingSchemeConfiguration::addMultiDataToBeExchanged(
         index++;
       }
       assertion(index < _config.participants.size(), index, _config.participants.size());
-      scheme.addDataToSend(data, mesh, initialize, index);
+      scheme.addDataToSend(data, mesh, initialize, index, get<5>(tuple));
     } else {
       size_t index = 0;
       for (const std::string &participant : _config.participants) {
@@ -906,7 +950,7 @@ void CouplingSchemeConfiguration::addMultiDataToBeExchanged(
         index++;
       }
       assertion(index < _config.participants.size(), index, _config.participants.size());
-      scheme.addDataToReceive(data, mesh, initialize, index);
+      scheme.addDataToReceive(data, mesh, initialize, index, get<5>(tuple));
     }
   }
 }
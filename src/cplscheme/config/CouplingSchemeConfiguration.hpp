@@ -9,6 +9,7 @@
 #include "cplscheme/SharedPointer.hpp"
 #include "cplscheme/impl/SharedPointer.hpp"
 #include "logging/Logger.hpp"
+#include "m2n/SharedPointer.hpp"
 #include "m2n/config/M2NConfiguration.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "precice/config/SharedPointer.hpp"
@@ -118,6 +119,8 @@ private:
   const std::string ATTR_SUFFICES;
   const std::string ATTR_CONTROL;
   const std::string ATTR_LEVEL;
+  const std::string ATTR_COMPRESSION;
+  const std::string ATTR_COMPRESSION_TOLERANCE;
 
   const std::string VALUE_SERIAL_EXPLICIT;
   const std::string VALUE_PARALLEL_EXPLICIT;
@@ -126,6 +129,11 @@ private:
   const std::string VALUE_MULTI;
   const std::string VALUE_FIXED;
   const std::string VALUE_FIRST_PARTICIPANT;
+  const std::string VALUE_NONE;
+  const std::string VALUE_LOSSLESS;
+  const std::string VALUE_DELTA;
+  const std::string VALUE_LOSSY;
+  const std::string VALUE_SPARSE;
 
   struct Config {
     std::string                   type;
@@ -138,9 +146,9 @@ private:
     double                        timestepLength;
     int                           validDigits;
     constants::TimesteppingMethod dtMethod;
-    /// Tuples of exchange data, mesh, and participant name.
-    typedef std::tuple<mesh::PtrData, mesh::PtrMesh, std::string, std::string, bool> Exchange;
-    std::vector<Exchange>                                                            exchanges;
+    /// Tuples of exchange data, mesh, participant names, initialize flag, and compressor.
+    typedef std::tuple<mesh::PtrData, mesh::PtrMesh, std::string, std::string, bool, m2n::PtrCompressor> Exchange;
+    std::vector<Exchange>                                                                                exchanges;
     /// Tuples of data ID, mesh ID, and convergence measure.
     std::vector<std::tuple<int, bool, std::string, int, impl::PtrConvergenceMeasure>> convMeasures;
     int                                                                               maxIterations;
@@ -46,6 +46,8 @@ PostProcessingConfiguration::PostProcessingConfiguration(
       TAG_ESTIMATEJACOBIAN("estimate-jacobian"),
       TAG_PRECONDITIONER("preconditioner"),
       TAG_IMVJRESTART("imvj-restart-mode"),
+      TAG_ORTHOGONALIZATION("orthogonalization"),
+      TAG_HISTORY_PRECISION("history-precision"),
       ATTR_NAME("name"),
       ATTR_MESH("mesh"),
       ATTR_SCALING("scaling"),
@@ -68,6 +70,10 @@ PostProcessingConfiguration::PostProcessingConfiguration(
       VALUE_QR1FILTER("QR1"),
       VALUE_QR1_ABSFILTER("QR1-absolute"),
       VALUE_QR2FILTER("QR2"),
+      VALUE_MGS("MGS"),
+      VALUE_CGS2("CGS2"),
+      VALUE_DOUBLE_PRECISION("double"),
+      VALUE_SINGLE_PRECISION("single"),
       VALUE_CONSTANT_PRECONDITIONER("constant"),
       VALUE_VALUE_PRECONDITIONER("value"),
       VALUE_RESIDUAL_PRECONDITIONER("residual"),
@@ -76,6 +82,7 @@ PostProcessingConfiguration::PostProcessingConfiguration(
       VALUE_ZERO_RESTART("RS-0"),
       VALUE_SVD_RESTART("RS-SVD"),
       VALUE_SLIDE_RESTART("RS-SLIDE"),
+      VALUE_LOWRANK_RESTART("low-rank"),
       VALUE_NO_RESTART("no-restart"),
       //_isValid(false),
       _meshConfig(meshConfig),
@@ -221,6 +228,17 @@ void PostProcessingConfiguration::xmlTagCallback(
       assertion(false);
     }
     _config.singularityLimit = callingTag.getDoubleAttributeValue(ATTR_SINGULARITYLIMIT);
+  } else if (callingTag.getName() == TAG_ORTHOGONALIZATION) {
+    auto f = callingTag.getStringAttributeValue(ATTR_TYPE);
+    if (f == VALUE_MGS) {
+      _config.orthogonalization = impl::QRFactorization::MGS;
+    } else if (f == VALUE_CGS2) {
+      _config.orthogonalization = impl::QRFactorization::CGS2;
+    } else {
+      assertion(false);
+    }
+  } else if (callingTag.getName() == TAG_HISTORY_PRECISION) {
+    _config.singlePrecisionHistory = callingTag.getStringAttributeValue(ATTR_TYPE) == VALUE_SINGLE_PRECISION;
   } else if (callingTag.getName() == TAG_ESTIMATEJACOBIAN) {
     if (_config.type == VALUE_ManifoldMapping)
       _config.estimateJacobian = callingTag.getBooleanAttributeValue(ATTR_VALUE);
@@ -247,6 +265,11 @@ void PostProcessingConfiguration::xmlTagCallback(
       _config.imvjRestartType         = impl::MVQNPostProcessing::RS_SVD;
     } else if (f == VALUE_SLIDE_RESTART) {
       _config.imvjRestartType = impl::MVQNPostProcessing::RS_SLIDE;
+    } else if (f == VALUE_LOWRANK_RESTART) {
+      // the information of each time step is merged into the truncated SVD right away
+      _config.imvjRSSVD_truncationEps = callingTag.getDoubleAttributeValue(ATTR_RSSVD_TRUNCATIONEPS);
+      _config.imvjRestartType         = impl::MVQNPostProcessing::LOW_RANK;
+      _config.imvjChunkSize           = 1;
     } else {
       _config.imvjChunkSize = 0;
       assertion(false);
@@ -364,6 +387,13 @@ void PostProcessingConfiguration::xmlEndTagCallback(
     } else {
       assertion(false);
     }
+
+    if (auto qnPostProcessing = std::dynamic_pointer_cast<impl::BaseQNPostProcessing>(_postProcessing)) {
+      qnPostProcessing->setOrthogonalization(_config.orthogonalization);
+    }
+    if (auto ilsPostProcessing = std::dynamic_pointer_cast<impl::IQNILSPostProcessing>(_postProcessing)) {
+      ilsPostProcessing->setSinglePrecisionHistory(_config.singlePrecisionHistory);
+    }
   }
 }
 
@@ -470,6 +500,34 @@ void PostProcessingConfiguration::addTypeSpecificSubtags(
                                "are filtered out.");
     tag.addSubtag(tagFilter);
 
+    XMLTag                       tagOrthogonalization(*this, TAG_ORTHOGONALIZATION, XMLTag::OCCUR_NOT_OR_ONCE);
+    XMLAttribute<std::string>    attrOrthogonalizationType(ATTR_TYPE);
+    ValidatorEquals<std::string> validMGS(VALUE_MGS);
+    ValidatorEquals<std::string> validCGS2(VALUE_CGS2);
+    attrOrthogonalizationType.setValidator(validMGS || validCGS2);
+    tagOrthogonalization.addAttribute(attrOrthogonalizationType);
+    tagOrthogonalization.setDocumentation("Gram-Schmidt variant that is used to insert new columns into the QR "
+                                          "decomposition of the least-squares system. Possible variants:\n"
+                                          "  MGS: one global reduction for every existing column (default)\n"
+                                          "  CGS2: classical Gram-Schmidt with re-orthogonalization, one global "
+                                          "reduction for all columns per sweep. Recommended for many ranks.");
+    tag.addSubtag(tagOrthogonalization);
+
+    XMLTag                       tagHistoryPrecision(*this, TAG_HISTORY_PRECISION, XMLTag::OCCUR_NOT_OR_ONCE);
+    XMLAttribute<std::string>    attrHistoryPrecisionType(ATTR_TYPE);
+    ValidatorEquals<std::string> validDouble(VALUE_DOUBLE_PRECISION);
+    ValidatorEquals<std::string> validSingle(VALUE_SINGLE_PRECISION);
+    attrHistoryPrecisionType.setValidator(validDouble || validSingle);
+    tagHistoryPrecision.addAttribute(attrHistoryPrecisionType);
+    tagHistoryPrecision.setDocumentation("Floating point precision in which the history of solver output differences "
+                                         "(matrix W) is stored. Possible values:\n"
+                                         "  double: full precision (default)\n"
+                                         "  single: halves the memory of W, all products are still accumulated in "
+                                         "double precision. The residual differences V and the QR decomposition "
+                                         "are always stored in double precision. Only available for IQN-ILS, as the "
+                                         "inverse Jacobian of IQN-IMVJ would accumulate the rounding over time steps.");
+    tag.addSubtag(tagHistoryPrecision);
+
     XMLTag                       tagPreconditioner(*this, TAG_PRECONDITIONER, XMLTag::OCCUR_NOT_OR_ONCE);
     XMLAttribute<std::string>    attrPreconditionerType(ATTR_TYPE);
     ValidatorEquals<std::string> valid1(VALUE_CONSTANT_PRECONDITIONER);
@@ -506,7 +564,8 @@ void PostProcessingConfiguration::addTypeSpecificSubtags(
     ValidatorEquals<std::string> validRS_LS(VALUE_LS_RESTART);
     ValidatorEquals<std::string> validRS_SVD(VALUE_SVD_RESTART);
     ValidatorEquals<std::string> validRS_SLIDE(VALUE_SLIDE_RESTART);
-    attrRestartName.setValidator(validNO_RS || validRS_ZERO || validRS_LS || validRS_SVD || validRS_SLIDE);
+    ValidatorEquals<std::string> validLOWRANK(VALUE_LOWRANK_RESTART);
+    attrRestartName.setValidator(validNO_RS || validRS_ZERO || validRS_LS || validRS_SVD || validRS_SLIDE || validLOWRANK);
     attrRestartName.setDefaultValue(VALUE_SVD_RESTART);
     tagIMVJRESTART.addAttribute(attrRestartName);
     tagIMVJRESTART.setDocumentation("Type of IMVJ restart mode that is used\n"
@@ -514,7 +573,9 @@ void PostProcessingConfiguration::addTypeSpecificSubtags(
                                     "  RS-ZERO:    IMVJ runs in restart mode. After M time steps all Jacobain information is dropped, restart with no information\n"
                                     "  RS-LS:      IMVJ runs in restart mode. After M time steps a IQN-LS like approximation for the initial guess of the Jacobian is computed.\n"
                                     "  RS-SVD:     IMVJ runs in restart mode. After M time steps a truncated SVD of the Jacobian is updated.\n"
-                                    "  RS-SLIDE:   IMVJ runs in sliding window restart mode.\n");
+                                    "  RS-SLIDE:   IMVJ runs in sliding window restart mode.\n"
+                                    "  low-rank:   IMVJ never builds the Jacobian, but keeps it as truncated SVD of the previous time steps plus the\n"
+                                    "              update of the current time step. The SVD is updated after every time step, chunk-size is ignored.\n");
     XMLAttribute<int> attrChunkSize(ATTR_IMVJCHUNKSIZE);
     attrChunkSize.setDocumentation("Specifies the number of time steps M after which the IMVJ restarts, if run in restart-mode. Defaul value is M=8.");
     attrChunkSize.setDefaultValue(8);
@@ -522,7 +583,7 @@ void PostProcessingConfiguration::addTypeSpecificSubtags(
     attrReusedTimeStepsAtRestart.setDocumentation("If IMVJ restart-mode=RS-LS, the number of reused time steps at restart can be specified.");
     attrReusedTimeStepsAtRestart.setDefaultValue(8);
     XMLAttribute<double> attrRSSVD_truncationEps(ATTR_RSSVD_TRUNCATIONEPS);
-    attrRSSVD_truncationEps.setDocumentation("If IMVJ restart-mode=RS-SVD, the truncation threshold for the updated SVD can be set.");
+    attrRSSVD_truncationEps.setDocumentation("If IMVJ restart-mode=RS-SVD or low-rank, the truncation threshold for the updated SVD can be set.");
     attrRSSVD_truncationEps.setDefaultValue(1e-4);
     tagIMVJRESTART.addAttribute(attrChunkSize);
     tagIMVJRESTART.addAttribute(attrReusedTimeStepsAtRestart);
@@ -570,6 +631,19 @@ void PostProcessingConfiguration::addTypeSpecificSubtags(
                                "are filtered out.");
     tag.addSubtag(tagFilter);
 
+    XMLTag                       tagOrthogonalization(*this, TAG_ORTHOGONALIZATION, XMLTag::OCCUR_NOT_OR_ONCE);
+    XMLAttribute<std::string>    attrOrthogonalizationType(ATTR_TYPE);
+    ValidatorEquals<std::string> validMGS(VALUE_MGS);
+    ValidatorEquals<std::string> validCGS2(VALUE_CGS2);
+    attrOrthogonalizationType.setValidator(validMGS || validCGS2);
+    tagOrthogonalization.addAttribute(attrOrthogonalizationType);
+    tagOrthogonalization.setDocumentation("Gram-Schmidt variant that is used to insert new columns into the QR "
+                                          "decomposition of the least-squares system. Possible variants:\n"
+                                          "  MGS: one global reduction for every existing column (default)\n"
+                                          "  CGS2: classical Gram-Schmidt with re-orthogonalization, one global "
+                                          "reduction for all columns per sweep. Recommended for many ranks.");
+    tag.addSubtag(tagOrthogonalization);
+
     XMLTag                       tagPreconditioner(*this, TAG_PRECONDITIONER, XMLTag::OCCUR_NOT_OR_ONCE);
     XMLAttribute<std::string>    attrPreconditionerType(ATTR_TYPE);
     ValidatorEquals<std::string> valid1(VALUE_CONSTANT_PRECONDITIONER);
@@ -2,6 +2,7 @@
 
 #include "cplscheme/impl/MVQNPostProcessing.hpp"
 #include "cplscheme/impl/PostProcessing.hpp"
+#include "cplscheme/impl/QRFactorization.hpp"
 #include "cplscheme/impl/SharedPointer.hpp"
 #include "logging/Logger.hpp"
 #include "mesh/SharedPointer.hpp"
@@ -64,6 +65,8 @@ private:
   const std::string TAG_ESTIMATEJACOBIAN;
   const std::string TAG_PRECONDITIONER;
   const std::string TAG_IMVJRESTART;
+  const std::string TAG_ORTHOGONALIZATION;
+  const std::string TAG_HISTORY_PRECISION;
 
   const std::string ATTR_NAME;
   const std::string ATTR_MESH;
@@ -88,6 +91,10 @@ private:
   const std::string VALUE_QR1FILTER;
   const std::string VALUE_QR1_ABSFILTER;
   const std::string VALUE_QR2FILTER;
+  const std::string VALUE_MGS;
+  const std::string VALUE_CGS2;
+  const std::string VALUE_DOUBLE_PRECISION;
+  const std::string VALUE_SINGLE_PRECISION;
   const std::string VALUE_CONSTANT_PRECONDITIONER;
   const std::string VALUE_VALUE_PRECONDITIONER;
   const std::string VALUE_RESIDUAL_PRECONDITIONER;
@@ -96,6 +103,7 @@ private:
   const std::string VALUE_ZERO_RESTART;
   const std::string VALUE_SVD_RESTART;
   const std::string VALUE_SLIDE_RESTART;
+  const std::string VALUE_LOWRANK_RESTART;
   const std::string VALUE_NO_RESTART;
 
   //bool _isValid;
@@ -123,6 +131,8 @@ private:
     int                   maxIterationsUsed;
     int                   timestepsReused;
     int                   filter;
+    int                   orthogonalization;
+    bool                  singlePrecisionHistory;
     int                   imvjRestartType;
     int                   imvjChunkSize;
     int                   imvjRSLS_reustedTimesteps;
@@ -142,6 +152,8 @@ private:
           maxIterationsUsed(0),
           timestepsReused(0),
           filter(impl::PostProcessing::NOFILTER),
+          orthogonalization(impl::QRFactorization::MGS),
+          singlePrecisionHistory(false),
           imvjRestartType(0), // NO-RESTART
           imvjChunkSize(0),
           imvjRSLS_reustedTimesteps(0),
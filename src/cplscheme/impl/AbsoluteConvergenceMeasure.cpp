@@ -16,6 +16,7 @@ AbsoluteConvergenceMeasure::AbsoluteConvergenceMeasure(
     : ConvergenceMeasure(),
       _convergenceLimit(convergenceLimit),
       _normDiff(0.0),
+      _normDiffHandle(-1),
       _isConvergence(false)
 {
   CHECK(not math::greaterEquals(0.0, _convergenceLimit),
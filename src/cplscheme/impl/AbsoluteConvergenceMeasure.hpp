@@ -44,12 +44,18 @@ public:
     _isConvergence = false;
   }
 
-  virtual void measure(
+  virtual void addNorms(
       const Eigen::VectorXd &oldValues,
       const Eigen::VectorXd &newValues,
-      const Eigen::VectorXd &designSpecification)
+      const Eigen::VectorXd &designSpecification,
+      NormBatch &            batch)
   {
-    _normDiff      = utils::MasterSlave::l2norm((newValues - oldValues) - designSpecification);
+    _normDiffHandle = batch.add((newValues - oldValues) - designSpecification);
+  }
+
+  virtual void evaluate(const NormBatch &batch)
+  {
+    _normDiff      = batch.norm(_normDiffHandle);
     _isConvergence = _normDiff <= _convergenceLimit;
     //      INFO("Absolute convergence measure: "
     //                     << "two-norm differences = " << normDiff
@@ -89,6 +95,9 @@ private:
 
   double _normDiff;
 
+  /// Handle of the norm of the differences in the current NormBatch.
+  int _normDiffHandle;
+
   bool _isConvergence;
 };
 }
@@ -8,6 +8,7 @@
 #include "utils/EigenHelperFunctions.hpp"
 #include "utils/Globals.hpp"
 #include "utils/MasterSlave.hpp"
+#include "utils/ThreadPool.hpp"
 //#include "utils/NumericalCompare.hpp"
 
 namespace precice
@@ -52,6 +53,7 @@ BaseQNPostProcessing::BaseQNPostProcessing(
       _matrixW(),
       _qrV(filter),
       _filter(filter),
+      _orthogonalization(QRFactorization::MGS),
       _singularityLimit(singularityLimit),
       _matrixCols(),
       _dimOffsets(),
@@ -137,6 +139,19 @@ void BaseQNPostProcessing::initialize(
   if (not(_designSpecification.size() > 0)) {
     _designSpecification = Eigen::VectorXd::Zero(_residuals.size());
   }
+
+  // V and W hold at most _maxIterationsUsed columns, reserve them once
+  _matrixV.reserve(entries, _maxIterationsUsed);
+  _matrixW.reserve(entries, _maxIterationsUsed);
+
+  _workspace.xUpdate.resize(entries);
+  _workspace.deltaR.resize(entries);
+  _workspace.deltaXTilde.resize(entries);
+  _workspace.negativeResiduals.resize(entries);
+  _workspace.partialUpdate.resize(entries);
+  _workspace.localRhs.resize(_maxIterationsUsed);
+  _workspace.globalRhs.resize(_maxIterationsUsed);
+  _workspace.coefficients.resize(_maxIterationsUsed);
   /**
    *  make dimensions public to all procs,
    *  last entry _dimOffsets[MasterSlave::_size] holds the global dimension, global,n
@@ -258,8 +273,9 @@ void BaseQNPostProcessing::updateDifferenceMatrices(
   TRACE();
   
   // Compute current residual: vertex-data - oldData
-  _residuals = _values;
-  _residuals -= _oldValues;
+  utils::ThreadPool::getInstance().parallelFor(_residuals.size(), [this](int begin, int end) {
+    _residuals.segment(begin, end - begin) = _values.segment(begin, end - begin) - _oldValues.segment(begin, end - begin);
+  });
 
   //if (_firstIteration && (_firstTimeStep || (_matrixCols.size() < 2))) {
   if (_firstIteration && (_firstTimeStep || _forceInitialRelaxation)) {
@@ -276,18 +292,20 @@ void BaseQNPostProcessing::updateDifferenceMatrices(
         WARN(
             "The number of columns in the least squares system exceeded half the number of unknowns at the interface. The system will probably become bad or ill-conditioned and the quasi-Newton post processing may not converge. Maybe the number of allowed columns (maxIterationsUsed) should be limited.");
 
-      Eigen::VectorXd deltaR = _residuals;
+      Eigen::VectorXd &deltaR = _workspace.deltaR;
+      deltaR                  = _residuals;
       deltaR -= _oldResiduals;
 
-      Eigen::VectorXd deltaXTilde = _values;
+      Eigen::VectorXd &deltaXTilde = _workspace.deltaXTilde;
+      deltaXTilde                  = _values;
       deltaXTilde -= _oldXTilde;
 
       bool columnLimitReached = getLSSystemCols() == _maxIterationsUsed;
       bool overdetermined     = getLSSystemCols() <= getLSSystemRows();
       if (not columnLimitReached && overdetermined) {
 
-        utils::appendFront(_matrixV, deltaR);
-        utils::appendFront(_matrixW, deltaXTilde);
+        _matrixV.pushFront(deltaR);
+        _matrixW.pushFront(deltaXTilde);
 
         // insert column deltaR = _residuals - _oldResiduals at pos. 0 (front) into the
         // QR decomposition and update decomposition
@@ -298,8 +316,10 @@ void BaseQNPostProcessing::updateDifferenceMatrices(
 
         _matrixCols.front()++;
       } else {
-        utils::shiftSetFirst(_matrixV, deltaR);
-        utils::shiftSetFirst(_matrixW, deltaXTilde);
+        _matrixV.popBack();
+        _matrixW.popBack();
+        _matrixV.pushFront(deltaR);
+        _matrixW.pushFront(deltaXTilde);
 
         // inserts column deltaR at pos. 0 to the QR decomposition and deletes the last column
         // the QR decomposition of V is updated
@@ -368,10 +388,11 @@ void BaseQNPostProcessing::performPostProcessing(
 
     // Perform constant relaxation
     // with residual: x_new = x_old + omega * (res-q)
-    _residuals *= _initialRelaxation;
-    _residuals -= (_designSpecification * _initialRelaxation);
-    _residuals += _oldValues;
-    _values = _residuals;
+    utils::ThreadPool::getInstance().parallelFor(_residuals.size(), [this](int begin, int end) {
+      auto residuals = _residuals.segment(begin, end - begin);
+      residuals      = residuals * _initialRelaxation - _designSpecification.segment(begin, end - begin) * _initialRelaxation + _oldValues.segment(begin, end - begin);
+      _values.segment(begin, end - begin) = residuals;
+    });
 
     computeUnderrelaxationSecondaryData(cplData);
   } else {
@@ -383,15 +404,15 @@ void BaseQNPostProcessing::performPostProcessing(
       DEBUG("   Last time step converged after one iteration. Need to restore the matrices from backup.");
 
       _matrixCols = _matrixColsBackup;
-      _matrixV    = _matrixVBackup;
-      _matrixW    = _matrixWBackup;
+      _matrixV.assign(_matrixVBackup);
+      _matrixW.assign(_matrixWBackup);
 
       // re-computation of QR decomposition from _matrixV = _matrixVBackup
       // this occurs very rarely, to be precise, it occurs only if the coupling terminates
       // after the first iteration and the matrix data from time step t-2 has to be used
-      _preconditioner->apply(_matrixV);
-      _qrV.reset(_matrixV, getLSSystemRows());
-      _preconditioner->revert(_matrixV);
+      _preconditioner->apply(_matrixV.matrix());
+      _qrV.reset(_matrixV.matrix(), getLSSystemRows());
+      _preconditioner->revert(_matrixV.matrix());
       _resetLS = true; // need to recompute _Wtil, Q, R (only for IMVJ efficient update)
     }
 
@@ -410,11 +431,11 @@ void BaseQNPostProcessing::performPostProcessing(
 
     _preconditioner->update(false, _values, _residuals);
     // apply scaling to V, V' := P * V (only needed to reset the QR-dec of V)
-    _preconditioner->apply(_matrixV);
+    _preconditioner->apply(_matrixV.matrix());
 
     if (_preconditioner->requireNewQR()) {
       if (not(_filter == PostProcessing::QR2FILTER)) { //for QR2 filter, there is no need to do this twice
-        _qrV.reset(_matrixV, getLSSystemRows());
+        _qrV.reset(_matrixV.matrix(), getLSSystemRows());
       }
       _preconditioner->newQRfulfilled();
     }
@@ -423,20 +444,24 @@ void BaseQNPostProcessing::performPostProcessing(
     applyFilter();
 
     // revert scaling of V, in computeQNUpdate all data objects are unscaled.
-    _preconditioner->revert(_matrixV);
+    _preconditioner->revert(_matrixV.matrix());
 
     /**
      * compute quasi-Newton update
      * PRECONDITION: All objects are unscaled, except the matrices within the QR-dec of V.
      *               Thus, the pseudo inverse needs to be reverted before using it.
      */
-    Eigen::VectorXd xUpdate = Eigen::VectorXd::Zero(_residuals.size());
+    Eigen::VectorXd &xUpdate = _workspace.xUpdate;
+    xUpdate.setZero();
     computeQNUpdate(cplData, xUpdate);
 
     /**
      * apply quasiNewton update
      */
-    _values = _oldValues + xUpdate + _residuals; // = x^k + delta_x + r^k - q^k
+    utils::ThreadPool::getInstance().parallelFor(_values.size(), [this, &xUpdate](int begin, int end) {
+      // = x^k + delta_x + r^k - q^k
+      _values.segment(begin, end - begin) = _oldValues.segment(begin, end - begin) + xUpdate.segment(begin, end - begin) + _residuals.segment(begin, end - begin);
+    });
 
     // TODO: maybe add design specification. Though, residuals are overwritten in the next iteration this would be a clearer and nicer code
 
@@ -447,15 +472,15 @@ void BaseQNPostProcessing::performPostProcessing(
       // after the first iteration (no new data, i.e., V = W = 0)
       if (getLSSystemCols() > 0) {
         _matrixColsBackup = _matrixCols;
-        _matrixVBackup    = _matrixV;
-        _matrixWBackup    = _matrixW;
+        _matrixVBackup    = _matrixV.matrix();
+        _matrixWBackup.assign(_matrixW);
       }
       // if no time steps reused, the matrix data needs to be cleared as it was only needed for the
       // QN-step in the first iteration (idea: rather perform QN-step with information from last converged
       // time step instead of doing a underrelaxation)
       if (not _firstTimeStep) {
-        _matrixV.resize(0, 0);
-        _matrixW.resize(0, 0);
+        _matrixV.clear();
+        _matrixW.clear();
         _matrixCols.clear();
         _matrixCols.push_front(0); // vital after clear()
         _qrV.reset();
@@ -498,7 +523,7 @@ void BaseQNPostProcessing::applyFilter()
   } else {
     // do: filtering of least-squares system to maintain good conditioning
     std::vector<int> delIndices(0);
-    _qrV.applyFilter(_singularityLimit, delIndices, _matrixV);
+    _qrV.applyFilter(_singularityLimit, delIndices, _matrixV.matrix());
     // start with largest index (as V,W matrices are shrinked and shifted
     for (int i = delIndices.size() - 1; i >= 0; i--) {
 
@@ -520,10 +545,10 @@ void BaseQNPostProcessing::concatenateCouplingData(
     int         size      = cplData[id]->values->size();
     auto &      values    = *cplData[id]->values;
     const auto &oldValues = cplData[id]->oldValues.col(0);
-    for (int i = 0; i < size; i++) {
-      _values(i + offset)    = values(i);
-      _oldValues(i + offset) = oldValues(i);
-    }
+    utils::ThreadPool::getInstance().parallelFor(size, [&](int begin, int end) {
+      _values.segment(offset + begin, end - begin)    = values.segment(begin, end - begin);
+      _oldValues.segment(offset + begin, end - begin) = oldValues.segment(begin, end - begin);
+    });
     offset += size;
   }
 }
@@ -535,14 +560,13 @@ void BaseQNPostProcessing::splitCouplingData(
 
   int offset = 0;
   for (int id : _dataIDs) {
-    int   size       = cplData[id]->values->size();
-    auto &valuesPart = *(cplData[id]->values);
-    //Eigen::VectorXd& oldValuesPart = cplData[id]->oldValues.col(0);
-    cplData[id]->oldValues.col(0) = _oldValues.segment(offset, size); // TODO: check if this is correct
-    for (int i = 0; i < size; i++) {
-      valuesPart(i) = _values(i + offset);
-      //oldValuesPart(i) = _oldValues(i + offset);
-    }
+    int   size          = cplData[id]->values->size();
+    auto &valuesPart    = *(cplData[id]->values);
+    auto  oldValuesPart = cplData[id]->oldValues.col(0); // TODO: check if this is correct
+    utils::ThreadPool::getInstance().parallelFor(size, [&](int begin, int end) {
+      valuesPart.segment(begin, end - begin)    = _values.segment(offset + begin, end - begin);
+      oldValuesPart.segment(begin, end - begin) = _oldValues.segment(offset + begin, end - begin);
+    });
     offset += size;
   }
 }
@@ -604,8 +628,8 @@ void BaseQNPostProcessing::iterationsConverged(
 
   if (_timestepsReused == 0) {
     if (_forceInitialRelaxation) {
-      _matrixV.resize(0, 0);
-      _matrixW.resize(0, 0);
+      _matrixV.clear();
+      _matrixW.clear();
       _qrV.reset();
       // set the number of global rows in the QRFactorization. This is essential for the correctness in master-slave mode!
       _qrV.setGlobalRows(getLSSystemRows());
@@ -626,8 +650,8 @@ void BaseQNPostProcessing::iterationsConverged(
 
     // remove columns
     for (int i = 0; i < toRemove; i++) {
-      utils::removeColumnFromMatrix(_matrixV, _matrixV.cols() - 1);
-      utils::removeColumnFromMatrix(_matrixW, _matrixW.cols() - 1);
+      _matrixV.popBack();
+      _matrixW.popBack();
       // also remove the corresponding columns from the dynamic QR-descomposition of _matrixV
       _qrV.popBack();
     }
@@ -653,8 +677,8 @@ void BaseQNPostProcessing::removeMatrixColumn(
   _nbDelCols++;
 
   assertion(_matrixV.cols() > 1);
-  utils::removeColumnFromMatrix(_matrixV, columnIndex);
-  utils::removeColumnFromMatrix(_matrixW, columnIndex);
+  _matrixV.removeColumn(columnIndex);
+  _matrixW.removeColumn(columnIndex);
 
   // Reduce column count
   std::deque<int>::iterator iter = _matrixCols.begin();
@@ -688,6 +712,12 @@ int BaseQNPostProcessing::getDeletedColumns()
   return _nbDelCols;
 }
 
+void BaseQNPostProcessing::setOrthogonalization(int orthogonalization)
+{
+  _orthogonalization = orthogonalization;
+  _qrV.setOrthogonalization(orthogonalization);
+}
+
 int BaseQNPostProcessing::getLSSystemCols()
 {
   int cols = 0;
@@ -4,6 +4,8 @@
 #include <deque>
 #include <fstream>
 #include <sstream>
+#include "ColumnBuffer.hpp"
+#include "MixedPrecisionColumnBuffer.hpp"
 #include "PostProcessing.hpp"
 #include "Preconditioner.hpp"
 #include "QRFactorization.hpp"
@@ -144,6 +146,13 @@ public:
   // delete this:
   virtual int getDeletedColumns();
 
+  /**
+    * @brief Sets the Gram-Schmidt variant used to update the QR decomposition of V.
+    *
+    * Either QRFactorization::MGS or QRFactorization::CGS2.
+    */
+  void setOrthogonalization(int orthogonalization);
+
 protected:
   /// @brief Logging device.
   static logging::Logger _log;
@@ -200,11 +209,35 @@ protected:
   /// @brief Current iteration residuals of secondary data.
   std::map<int, Eigen::VectorXd> _secondaryResiduals;
 
+  /** @brief Temporaries of one quasi-Newton iteration, sized in initialize() and reused afterwards.
+    *
+    * Vectors over the columns of the least-squares system hold _maxIterationsUsed entries
+    * and are used via head(getLSSystemCols()), i.e., they are not reallocated if the number
+    * of columns changes.
+    */
+  struct Workspace {
+    /// @brief Quasi-Newton update of the values, size of the local unknowns
+    Eigen::VectorXd xUpdate;
+    /// @brief Newest columns of V and W, size of the local unknowns
+    Eigen::VectorXd deltaR;
+    Eigen::VectorXd deltaXTilde;
+    /// @brief Negative residuals and partial updates, size of the local unknowns
+    Eigen::VectorXd negativeResiduals;
+    Eigen::VectorXd partialUpdate;
+    /// @brief Local and global right-hand side of the least-squares system, size _maxIterationsUsed
+    Eigen::VectorXd localRhs;
+    Eigen::VectorXd globalRhs;
+    /// @brief Coefficients of the least-squares solution, size _maxIterationsUsed
+    Eigen::VectorXd coefficients;
+  };
+
+  Workspace _workspace;
+
   /// @brief Stores residual deltas.
-  Eigen::MatrixXd _matrixV;
+  ColumnBuffer _matrixV;
 
   /// @brief Stores x tilde deltas, where x tilde are values computed by solvers.
-  Eigen::MatrixXd _matrixW;
+  MixedPrecisionColumnBuffer _matrixW;
 
   /// @brief Stores the current QR decomposition ov _matrixV, can be updated via deletion/insertion of columns
   QRFactorization _qrV;
@@ -214,6 +247,9 @@ protected:
     */
   int _filter;
 
+  /// @brief Gram-Schmidt variant of all QR decompositions, see QRFactorization::setOrthogonalization()
+  int _orthogonalization;
+
   /** @brief Determines sensitivity when two matrix columns are considered equal.
     *
     * When during the QR decomposition of the V matrix a pivot element smaller
@@ -306,9 +342,9 @@ private:
    *  initial relaxation, if previous time step converged within one iteration i.e., V and W
    *  are empty -- in this case restore V and W with time step t-2.
    */
-  Eigen::MatrixXd _matrixVBackup;
-  Eigen::MatrixXd _matrixWBackup;
-  std::deque<int> _matrixColsBackup;
+  Eigen::MatrixXd            _matrixVBackup;
+  MixedPrecisionColumnBuffer _matrixWBackup;
+  std::deque<int>            _matrixColsBackup;
 
   /// @ brief additional debugging info, is not important for computation:
   int _nbDelCols;
@@ -0,0 +1,138 @@
+#include "ColumnBuffer.hpp"
+#include <algorithm>
+#include "utils/assertion.hpp"
+
+namespace precice
+{
+namespace cplscheme
+{
+namespace impl
+{
+
+template <typename Scalar>
+BasicColumnBuffer<Scalar>::BasicColumnBuffer()
+    : _data(),
+      _first(0),
+      _cols(0)
+{
+}
+
+template <typename Scalar>
+void BasicColumnBuffer<Scalar>::reserve(
+    int rows,
+    int capacity)
+{
+  assertion(rows >= 0, rows);
+  assertion(capacity >= 0, capacity);
+  if (_cols == 0) {
+    if (rows != _data.rows() || capacity > this->capacity()) {
+      _data.resize(rows, 2 * std::max(capacity, this->capacity()));
+    }
+    _first = _data.cols();
+  } else {
+    assertion(rows == _data.rows(), rows, _data.rows());
+    if (capacity > this->capacity()) {
+      relocate(capacity);
+    }
+  }
+}
+
+template <typename Scalar>
+void BasicColumnBuffer<Scalar>::pushFront(
+    const Vector &column)
+{
+  if (_cols == 0 && column.size() != _data.rows()) {
+    reserve(column.size(), std::max(capacity(), 1));
+  }
+  assertion(column.size() == _data.rows(), column.size(), _data.rows());
+
+  if (_first == 0) {
+    // no space left in front of the window: move it to the end of the storage,
+    // or double the storage if the window already covers half of it
+    relocate((_cols < capacity()) ? capacity() : std::max(2 * capacity(), 1));
+  }
+  _first--;
+  _cols++;
+  _data.col(_first) = column;
+}
+
+template <typename Scalar>
+void BasicColumnBuffer<Scalar>::popBack()
+{
+  assertion(_cols > 0);
+  _cols--;
+}
+
+template <typename Scalar>
+void BasicColumnBuffer<Scalar>::removeColumn(
+    int index)
+{
+  assertion(index >= 0, index);
+  assertion(index < _cols, index, _cols);
+
+  if (index < _cols / 2) {
+    for (int i = index; i > 0; i--) {
+      _data.col(_first + i) = _data.col(_first + i - 1);
+    }
+    _first++;
+  } else {
+    for (int i = index; i < _cols - 1; i++) {
+      _data.col(_first + i) = _data.col(_first + i + 1);
+    }
+  }
+  _cols--;
+}
+
+template <typename Scalar>
+void BasicColumnBuffer<Scalar>::clear()
+{
+  _cols  = 0;
+  _first = _data.cols();
+}
+
+template <typename Scalar>
+void BasicColumnBuffer<Scalar>::assign(
+    const Eigen::Ref<const Matrix> &matrix)
+{
+  resize(matrix.rows(), matrix.cols());
+  this->matrix() = matrix;
+}
+
+template <typename Scalar>
+void BasicColumnBuffer<Scalar>::resize(
+    int rows,
+    int cols)
+{
+  assertion(rows >= 0, rows);
+  assertion(cols >= 0, cols);
+  if (rows != _data.rows() || cols > capacity()) {
+    _data.resize(rows, 2 * std::max(cols, capacity()));
+  }
+  _cols  = cols;
+  _first = _data.cols() - _cols;
+}
+
+template <typename Scalar>
+void BasicColumnBuffer<Scalar>::relocate(
+    int capacity)
+{
+  assertion(capacity >= _cols, capacity, _cols);
+  int first = 2 * capacity - _cols;
+
+  if (2 * capacity == _data.cols()) {
+    // source and target window must not overlap
+    assertion(_first + _cols <= first, _first, _cols, first);
+    _data.middleCols(first, _cols) = _data.middleCols(_first, _cols);
+  } else {
+    Matrix data(_data.rows(), 2 * capacity);
+    data.middleCols(first, _cols) = matrix();
+    _data.swap(data);
+  }
+  _first = first;
+}
+
+template class BasicColumnBuffer<double>;
+template class BasicColumnBuffer<float>;
+}
+}
+} // namespace precice, cplscheme, impl
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <Eigen/Core>
+
+namespace precice
+{
+namespace cplscheme
+{
+namespace impl
+{
+
+/**
+ * @brief Column store for the difference matrices of the quasi-Newton post-processings.
+ *
+ * The quasi-Newton matrices V, W grow at the front (newest column at index 0) and shrink at
+ * the back or at arbitrary filtered columns. Instead of reallocating and shifting the whole
+ * matrix on every insertion, the columns live in a window of a preallocated storage with twice
+ * the reserved capacity. Inserting at the front only moves the window start; once it hits the
+ * beginning of the storage, the window is moved to the end again, which amortizes to one column
+ * copy per insertion.
+ *
+ * The logical matrix is always a contiguous, column-major block of the storage. Hence, it can be
+ * handed to Eigen products, the QR factorization and the preconditioner as a view without copies.
+ *
+ * The scalar type is a template parameter to allow for single precision storage, see
+ * MixedPrecisionColumnBuffer. Only double and float are instantiated.
+ */
+template <typename Scalar>
+class BasicColumnBuffer
+{
+public:
+  using Matrix    = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
+  using Vector    = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
+  using View      = typename Matrix::ColsBlockXpr;
+  using ConstView = typename Matrix::ConstColsBlockXpr;
+
+  BasicColumnBuffer();
+
+  /**
+   * @brief Preallocates storage for the given number of rows and columns.
+   *
+   * Existing columns are kept, the number of rows must not change if columns are stored.
+   */
+  void reserve(int rows, int capacity);
+
+  /// Inserts a column at position 0, i.e., all other columns shift right.
+  void pushFront(const Vector &column);
+
+  /// Deletes the column at position cols()-1.
+  void popBack();
+
+  /// Deletes the column at the given position, shifts the smaller part of the matrix.
+  void removeColumn(int index);
+
+  /// Deletes all columns, keeps the storage.
+  void clear();
+
+  /// Replaces the content by the columns of the given matrix, which may be a view.
+  void assign(const Eigen::Ref<const Matrix> &matrix);
+
+  /// Sets the size of the logical matrix, whose content is undefined afterwards.
+  void resize(int rows, int cols);
+
+  /// Returns a view of the logical matrix.
+  View matrix()
+  {
+    return _data.middleCols(_first, _cols);
+  }
+
+  /// Returns a view of the logical matrix.
+  ConstView matrix() const
+  {
+    return _data.middleCols(_first, _cols);
+  }
+
+  /// Returns the column at the given logical position.
+  typename Matrix::ColXpr col(int index)
+  {
+    return _data.col(_first + index);
+  }
+
+  int rows() const
+  {
+    return _data.rows();
+  }
+
+  int cols() const
+  {
+    return _cols;
+  }
+
+  /// Returns the column at the given logical position.
+  typename Matrix::ConstColXpr col(int index) const
+  {
+    return _data.col(_first + index);
+  }
+
+  /// Returns the number of columns that can be stored without reallocation.
+  int capacity() const
+  {
+    return _data.cols() / 2;
+  }
+
+private:
+  /// Moves the stored columns to the end of a storage for the given capacity.
+  void relocate(int capacity);
+
+  /// Storage of size rows x (2*capacity), the logical matrix is _data.middleCols(_first, _cols).
+  Matrix _data;
+
+  /// Storage index of logical column 0.
+  int _first;
+
+  /// Number of stored columns.
+  int _cols;
+};
+
+/// Column store in double precision, used for all difference matrices by default.
+using ColumnBuffer = BasicColumnBuffer<double>;
+}
+}
+} // namespace precice, cplscheme, impl
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include "NormBatch.hpp"
 
 namespace precice
 {
@@ -21,6 +22,10 @@ namespace impl
  * -# call newMeasurementSeries() for one set of iterations
  * -# call measure() for convergence measurement
  * -# retrieve the convergence status via isConvergence()
+ *
+ * To share one global reduction among several measures, measure() can be split up:
+ * call addNorms() of all measures with the same NormBatch, reduce the batch, and
+ * call evaluate() of all measures afterwards.
  */
 class ConvergenceMeasure
 {
@@ -37,10 +42,32 @@ public:
    * @param[in] oldValues Old iterate values.
    * @param[in] newValues New iterate values.
    */
-  virtual void measure(
+  void measure(
+      const Eigen::VectorXd &oldValues,
+      const Eigen::VectorXd &newValues,
+      const Eigen::VectorXd &designSpecification)
+  {
+    NormBatch batch;
+    addNorms(oldValues, newValues, designSpecification, batch);
+    batch.reduce();
+    evaluate(batch);
+  }
+
+  /**
+   * @brief Registers the norms needed for the convergence measurement.
+   *
+   * @param[in] oldValues Old iterate values.
+   * @param[in] newValues New iterate values.
+   * @param[in,out] batch Batch to add the local parts of the vectors to.
+   */
+  virtual void addNorms(
       const Eigen::VectorXd &oldValues,
       const Eigen::VectorXd &newValues,
-      const Eigen::VectorXd &designSpecification) = 0;
+      const Eigen::VectorXd &designSpecification,
+      NormBatch &            batch) = 0;
+
+  /// Performs convergence measurement with the norms registered by addNorms(), the batch has to be reduced.
+  virtual void evaluate(const NormBatch &batch) = 0;
 
   /// Returns true, if the last measurement indicates convergence.
   virtual bool isConvergence() const = 0;
@@ -39,6 +39,12 @@ IQNILSPostProcessing::IQNILSPostProcessing(
 {
 }
 
+void IQNILSPostProcessing::setSinglePrecisionHistory(
+    bool singlePrecision)
+{
+  _matrixW.setSinglePrecision(singlePrecision);
+}
+
 void IQNILSPostProcessing::initialize(
     DataMap &cplData)
 {
@@ -50,6 +56,7 @@ void IQNILSPostProcessing::initialize(
     if (not utils::contained(pair.first, _dataIDs)) {
       int secondaryEntries = pair.second->values->size();
       utils::append(_secondaryOldXTildes[pair.first], (Eigen::VectorXd) Eigen::VectorXd::Zero(secondaryEntries));
+      _secondaryMatricesW[pair.first].reserve(secondaryEntries, _maxIterationsUsed);
     }
   }
 }
@@ -77,18 +84,19 @@ void IQNILSPostProcessing::updateDifferenceMatrices(
 
         // Append column for secondary W matrices
         for (int id : _secondaryDataIDs) {
-          utils::appendFront(_secondaryMatricesW[id], _secondaryResiduals[id]);
+          _secondaryMatricesW[id].pushFront(_secondaryResiduals[id]);
         }
       } else {
         // Shift column for secondary W matrices
         for (int id : _secondaryDataIDs) {
-          utils::shiftSetFirst(_secondaryMatricesW[id], _secondaryResiduals[id]);
+          _secondaryMatricesW[id].popBack();
+          _secondaryMatricesW[id].pushFront(_secondaryResiduals[id]);
         }
       }
 
       // Compute delta_x_tilde for secondary data
       for (int id : _secondaryDataIDs) {
-        Eigen::MatrixXd &secW = _secondaryMatricesW[id];
+        ColumnBuffer &secW = _secondaryMatricesW[id];
         assertion(secW.rows() == cplData[id]->values->size(), secW.rows(), cplData[id]->values->size());
         secW.col(0) = *(cplData[id]->values);
         secW.col(0) -= _secondaryOldXTildes[id];
@@ -135,12 +143,11 @@ void IQNILSPostProcessing::computeQNUpdate(PostProcessing::DataMap &cplData, Eig
   DEBUG("   Compute Newton factors");
 
   // Calculate QR decomposition of matrix V and solve Rc = -Qr
-  Eigen::VectorXd c;
-
   // for master-slave mode and procs with no vertices,
   // qrV.cols() = getLSSystemCols() and _qrV.rows() = 0
   auto Q = _qrV.matrixQ();
   auto R = _qrV.matrixR();
+  int  m = _qrV.cols();
 
   if (!_hasNodesOnInterface) {
     assertion(_qrV.cols() == getLSSystemCols(), _qrV.cols(), getLSSystemCols());
@@ -148,51 +155,45 @@ void IQNILSPostProcessing::computeQNUpdate(PostProcessing::DataMap &cplData, Eig
     assertion(Q.size() == 0, Q.size());
   }
 
-  Eigen::VectorXd _local_b = Eigen::VectorXd::Zero(_qrV.cols());
-  Eigen::VectorXd _global_b;
+  // views of the preallocated workspace, no memory is allocated per iteration
+  assertion(m <= _workspace.coefficients.size(), m, _workspace.coefficients.size());
+  auto localB = _workspace.localRhs.head(m);
+  auto c      = _workspace.coefficients.head(m);
 
   // need to scale the residual to compensate for the scaling in c = R^-1 * Q^T * P^-1 * residual'
   // it is also possible to apply the inverse scaling weights from the right to the vector c
   _preconditioner->apply(_residuals);
-  _local_b = Q.transpose() * _residuals;
+  localB.noalias() = Q.transpose() * _residuals;
   _preconditioner->revert(_residuals);
-  _local_b *= -1.0; // = -Qr
-
-  assertion(c.size() == 0, c.size());
-  // reserve memory for c
-  utils::append(c, (Eigen::VectorXd) Eigen::VectorXd::Zero(_local_b.size()));
+  localB *= -1.0; // = -Qr
 
   // compute rhs Q^T*res in parallel
   if (not utils::MasterSlave::_masterMode && not utils::MasterSlave::_slaveMode) {
     assertion(Q.cols() == getLSSystemCols(), Q.cols(), getLSSystemCols());
     // back substitution
-    c = R.triangularView<Eigen::Upper>().solve<Eigen::OnTheLeft>(_local_b);
+    c = localB;
+    R.triangularView<Eigen::Upper>().solveInPlace(c);
   } else {
     assertion(utils::MasterSlave::_communication.get() != nullptr);
     assertion(utils::MasterSlave::_communication->isConnected());
     if (_hasNodesOnInterface)
       assertion(Q.cols() == getLSSystemCols(), Q.cols(), getLSSystemCols());
-    assertion(_local_b.size() == getLSSystemCols(), _local_b.size(), getLSSystemCols());
+    assertion(localB.size() == getLSSystemCols(), localB.size(), getLSSystemCols());
 
-    if (utils::MasterSlave::_masterMode) {
-      assertion(_global_b.size() == 0, _global_b.size());
-    }
-    utils::append(_global_b, (Eigen::VectorXd) Eigen::VectorXd::Zero(_local_b.size()));
+    auto globalB = _workspace.globalRhs.head(m);
 
-    // do a reduce operation to sum up all the _local_b vectors
-    utils::MasterSlave::reduceSum(_local_b.data(), _global_b.data(), _local_b.size()); // size = getLSSystemCols() = _local_b.size()
+    // do an allreduce operation to sum up all the localB vectors, modifies localB
+    utils::MasterSlave::allreduceSum(localB.data(), globalB.data(), m); // size = getLSSystemCols()
 
-    // back substitution R*c = b only in master node
-    if (utils::MasterSlave::_masterMode)
-      c = R.triangularView<Eigen::Upper>().solve<Eigen::OnTheLeft>(_global_b);
-
-    // broadcast coefficients c to all slaves
-    utils::MasterSlave::broadcast(c.data(), c.size());
+    // R is replicated on all ranks, hence, every rank does the (cheap) back substitution R*c = b
+    // itself instead of waiting for the coefficients to be broadcast by the master
+    c = globalB;
+    R.triangularView<Eigen::Upper>().solveInPlace(c);
   }
   
   DEBUG("   Apply Newton factors");
   // compute x updates from W and coefficients c, i.e, xUpdate = c*W
-  xUpdate = _matrixW * c;
+  _matrixW.multiply(c, xUpdate);
 
   //DEBUG("c = " << c);
 
@@ -204,7 +205,9 @@ void IQNILSPostProcessing::computeQNUpdate(PostProcessing::DataMap &cplData, Eig
   // to the LS system matrices and they need to be restored from the backup at time T-2
   if (not _firstTimeStep && (getLSSystemCols() < 1) && (_timestepsReused == 0) && not _forceInitialRelaxation) {
     DEBUG("   Last time step converged after one iteration. Need to restore the secondaryMatricesW from backup.");
-    _secondaryMatricesW = _secondaryMatricesWBackup;
+    for (int id : _secondaryDataIDs) {
+      _secondaryMatricesW[id].assign(_secondaryMatricesWBackup[id]);
+    }
   }
 
   // Perform QN relaxation for secondary data
@@ -212,7 +215,7 @@ void IQNILSPostProcessing::computeQNUpdate(PostProcessing::DataMap &cplData, Eig
     PtrCouplingData data   = cplData[id];
     auto &          values = *(data->values);
     assertion(_secondaryMatricesW[id].cols() == c.size(), _secondaryMatricesW[id].cols(), c.size());
-    values = _secondaryMatricesW[id] * c;
+    values.noalias() = _secondaryMatricesW[id].matrix() * c;
     assertion(values.size() == data->oldValues.col(0).size(), values.size(), data->oldValues.col(0).size());
     values += data->oldValues.col(0);
     assertion(values.size() == _secondaryResiduals[id].size(), values.size(), _secondaryResiduals[id].size());
@@ -224,10 +227,12 @@ void IQNILSPostProcessing::computeQNUpdate(PostProcessing::DataMap &cplData, Eig
     // save current secondaryMatrix data in case the coupling for the next time step will terminate
     // after the first iteration (no new data, i.e., V = W = 0)
     if (getLSSystemCols() > 0) {
-      _secondaryMatricesWBackup = _secondaryMatricesW;
+      for (int id : _secondaryDataIDs) {
+        _secondaryMatricesWBackup[id] = _secondaryMatricesW[id].matrix();
+      }
     }
     for (int id : _secondaryDataIDs) {
-      _secondaryMatricesW[id].resize(0, 0);
+      _secondaryMatricesW[id].clear();
     }
   }
 }
@@ -242,7 +247,7 @@ void IQNILSPostProcessing::specializedIterationsConverged(
   if (_timestepsReused == 0) {
     if (_forceInitialRelaxation) {
       for (int id : _secondaryDataIDs) {
-        _secondaryMatricesW[id].resize(0, 0);
+        _secondaryMatricesW[id].clear();
       }
     } else {
       /**
@@ -254,10 +259,10 @@ void IQNILSPostProcessing::specializedIterationsConverged(
   } else if ((int) _matrixCols.size() > _timestepsReused) {
     int toRemove = _matrixCols.back();
     for (int id : _secondaryDataIDs) {
-      Eigen::MatrixXd &secW = _secondaryMatricesW[id];
-      assertion(secW.cols() > toRemove, secW, toRemove, id);
+      ColumnBuffer &secW = _secondaryMatricesW[id];
+      assertion(secW.cols() > toRemove, secW.cols(), toRemove, id);
       for (int i = 0; i < toRemove; i++) {
-        utils::removeColumnFromMatrix(secW, secW.cols() - 1);
+        secW.popBack();
       }
     }
   }
@@ -269,7 +274,7 @@ void IQNILSPostProcessing::removeMatrixColumn(
   assertion(_matrixV.cols() > 1);
   // remove column from secondary Data Matrix W
   for (int id : _secondaryDataIDs) {
-    utils::removeColumnFromMatrix(_secondaryMatricesW[id], columnIndex);
+    _secondaryMatricesW[id].removeColumn(columnIndex);
   }
 
   BaseQNPostProcessing::removeMatrixColumn(columnIndex);
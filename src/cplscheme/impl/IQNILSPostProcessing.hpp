@@ -37,6 +37,14 @@ public:
 
   virtual ~IQNILSPostProcessing() {}
 
+  /**
+    * @brief Stores the difference matrix W in single precision, see MixedPrecisionColumnBuffer.
+    *
+    * Has to be set before initialize(). W only enters the update of the current iteration,
+    * hence, its rounding does not accumulate over time steps, as opposed to IQN-IMVJ.
+    */
+  void setSinglePrecisionHistory(bool singlePrecision);
+
   /// Initializes the post-processing.
   virtual void initialize(DataMap &cplData);
 
@@ -55,7 +63,7 @@ private:
   // @brief Secondary data x-tilde deltas.
   //
   // Stores x-tilde deltas for data not involved in least-squares computation.
-  std::map<int, Eigen::MatrixXd> _secondaryMatricesW;
+  std::map<int, ColumnBuffer>    _secondaryMatricesW;
   std::map<int, Eigen::MatrixXd> _secondaryMatricesWBackup;
 
   /// updates the V, W matrices (as well as the matrices for the secondary data)
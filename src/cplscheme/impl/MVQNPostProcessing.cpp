@@ -2,6 +2,7 @@
 
 #include "MVQNPostProcessing.hpp"
 #include <Eigen/Core>
+#include <algorithm>
 #include "com/Communication.hpp"
 #include "com/MPIPortsCommunication.hpp"
 #include "com/SocketCommunication.hpp"
@@ -101,9 +102,17 @@ void MVQNPostProcessing::initialize(
     _imvjRestart = true;
 
   // only need cyclic communication if no MVJ restart mode is used
-  if (not _imvjRestart) {
-    if (utils::MasterSlave::_masterMode || utils::MasterSlave::_slaveMode) {
-    /*
+  com::PtrCommunication cyclicCommLeft, cyclicCommRight;
+  if (not _imvjRestart && (utils::MasterSlave::_masterMode || utils::MasterSlave::_slaveMode)) {
+    if (utils::MasterSlave::_communicationFactory) {
+      // reuse the ring of the master-slave communication, which is closed together with it
+      utils::MasterSlave::_communication->connectRing(*utils::MasterSlave::_communicationFactory, "cyclicComm-",
+                                                      utils::MasterSlave::_rank, utils::MasterSlave::_size);
+      cyclicCommLeft  = utils::MasterSlave::_communication->getRingLeft();
+      cyclicCommRight = utils::MasterSlave::_communication->getRingRight();
+    } else {
+      /*
+       * Fallback for master-slave communications without a factory for further connections, i.e. mpi-single.
        * TODO: FIXME: This is a temporary and hacky realization of the cyclic commmunication between slaves
        *        Therefore the requesterName and accessorName are not given (cf solverInterfaceImpl).
        *        The master-slave communication should be modified such that direct communication between
@@ -149,12 +158,14 @@ void MVQNPostProcessing::initialize(
 #endif
         _cyclicCommLeft->acceptConnection("cyclicComm-" + std::to_string(prevProc), "");
       }
+      cyclicCommLeft  = _cyclicCommLeft;
+      cyclicCommRight = _cyclicCommRight;
     }
   }
 
   // initialize parallel matrix-matrix operation module
   _parMatrixOps = impl::PtrParMatrixOps(new impl::ParallelMatrixOperations());
-  _parMatrixOps->initialize(_cyclicCommLeft, _cyclicCommRight, not _imvjRestart);
+  _parMatrixOps->initialize(cyclicCommLeft, cyclicCommRight, not _imvjRestart);
   _svdJ.initialize(_parMatrixOps, getLSSystemRows());
 
   int entries  = _residuals.size();
@@ -177,7 +188,7 @@ void MVQNPostProcessing::initialize(
     _matrixV_RSLS = Eigen::MatrixXd::Zero(entries, 0);
     _matrixW_RSLS = Eigen::MatrixXd::Zero(entries, 0);
   }
-  _Wtil = Eigen::MatrixXd::Zero(entries, 0);
+  _Wtil.reserve(entries, _maxIterationsUsed);
 
   if (utils::MasterSlave::_masterMode || (not utils::MasterSlave::_masterMode && not utils::MasterSlave::_slaveMode))
     _infostringstream << " IMVJ restart mode: " << _imvjRestart << "\n chunk size: " << _chunkSize << "\n trunc eps: " << _svdJ.getThreshold() << "\n R_RS: " << _RSLSreusedTimesteps << "\n--------\n"
@@ -224,15 +235,18 @@ void MVQNPostProcessing::updateDifferenceMatrices(
       if (not _firstIteration) {
         // Update matrix _Wtil = (W - J_prev*V) with newest information
 
-        Eigen::VectorXd v = _matrixV.col(0);
-        Eigen::VectorXd w = _matrixW.col(0);
+        Eigen::VectorXd &v = _workspace.deltaR;
+        Eigen::VectorXd &w = _workspace.deltaXTilde;
+        v                  = _matrixV.col(0);
+        _matrixW.copyCol(0, w);
 
         // here, we check for _Wtil.cols() as the matrices V, W need to be updated before hand
         // and thus getLSSystemCols() does not yield the correct result.
         bool columnLimitReached = _Wtil.cols() == _maxIterationsUsed;
         bool overdetermined     = _Wtil.cols() <= getLSSystemRows();
 
-        Eigen::VectorXd wtil = Eigen::VectorXd::Zero(_matrixV.rows());
+        Eigen::VectorXd &wtil = _workspace.partialUpdate;
+        wtil.setZero();
 
         // add column: Wtil(:,0) = W(:,0) - sum_q [ Wtil^q * ( Z^q * V(:,0)) ]
         //                                         |--- J_prev ---|
@@ -268,9 +282,10 @@ void MVQNPostProcessing::updateDifferenceMatrices(
         wtil += w;
 
         if (not columnLimitReached && overdetermined) {
-          utils::appendFront(_Wtil, wtil);
+          _Wtil.pushFront(wtil);
         } else {
-          utils::shiftSetFirst(_Wtil, wtil);
+          _Wtil.popBack();
+          _Wtil.pushFront(wtil);
         }
       }
     }
@@ -308,7 +323,7 @@ void MVQNPostProcessing::computeQNUpdate(
 
 // ==================================================================================
 void MVQNPostProcessing::pseudoInverse(
-    Eigen::MatrixXd &pseudoInverse)
+    Eigen::Ref<Eigen::MatrixXd> pseudoInverse)
 {
   TRACE();
   /**
@@ -321,8 +336,6 @@ void MVQNPostProcessing::pseudoInverse(
   assertion(pseudoInverse.rows() == _qrV.cols(), pseudoInverse.rows(), _qrV.cols());
   assertion(pseudoInverse.cols() == _qrV.rows(), pseudoInverse.cols(), _qrV.rows());
 
-  Eigen::VectorXd yVec(pseudoInverse.rows());
-
   // assertions for the case of processors with no vertices
   if (!_hasNodesOnInterface) {
     assertion(_qrV.cols() == getLSSystemCols(), _qrV.cols(), getLSSystemCols());
@@ -332,9 +345,9 @@ void MVQNPostProcessing::pseudoInverse(
 
   // backsubstitution
   for (int i = 0; i < Q.rows(); i++) {
-    Eigen::VectorXd Qrow = Q.row(i);
-    yVec                 = R.triangularView<Eigen::Upper>().solve<Eigen::OnTheLeft>(Qrow);
-    pseudoInverse.col(i) = yVec;
+    auto zCol = pseudoInverse.col(i);
+    zCol      = Q.row(i).transpose();
+    R.triangularView<Eigen::Upper>().solveInPlace(zCol);
   } // ----------------
 
   // scale pseudo inverse back Z := Z' * P,
@@ -354,7 +367,10 @@ void MVQNPostProcessing::buildWtil()
   assertion(_matrixV.rows() == _qrV.rows(), _matrixV.rows(), _qrV.rows());
   assertion(getLSSystemCols() == _qrV.cols(), getLSSystemCols(), _qrV.cols());
 
-  _Wtil = Eigen::MatrixXd::Zero(_qrV.rows(), _qrV.cols());
+  // Wtil is computed in the storage of _Wtil, which only grows if the number of columns does.
+  _Wtil.resize(_qrV.rows(), _qrV.cols());
+  auto Wtil = _Wtil.matrix();
+  Wtil.setZero();
 
   // imvj restart mode: re-compute Wtil: Wtil = W - sum_q [ Wtil^q * (Z^q*V) ]
   //                                                      |--- J_prev ---|
@@ -365,21 +381,21 @@ void MVQNPostProcessing::buildWtil()
       assertion(colsLSSystemBackThen == _WtilChunk[i].cols(), colsLSSystemBackThen, _WtilChunk[i].cols());
       Eigen::MatrixXd ZV = Eigen::MatrixXd::Zero(colsLSSystemBackThen, _qrV.cols());
       // multiply: ZV := Z^q * V of size (m x m) with m=#cols, stored on each proc.
-      _parMatrixOps->multiply(_pseudoInverseChunk[i], _matrixV, ZV, colsLSSystemBackThen, getLSSystemRows(), _qrV.cols());
+      _parMatrixOps->multiply(_pseudoInverseChunk[i], _matrixV.matrix(), ZV, colsLSSystemBackThen, getLSSystemRows(), _qrV.cols());
       // multiply: Wtil^q * ZV  dimensions: (n x m) * (m x m), fully local and embarrassingly parallel
-      _Wtil += _WtilChunk[i] * ZV;
+      Wtil += _WtilChunk[i] * ZV;
     }
 
     // imvj without restart is used, i.e., recompute Wtil: Wtil = W - J_prev * V
   } else {
     // multiply J_prev * V = W_til of dimension: (n x n) * (n x m) = (n x m),
     //                                    parallel:  (n_global x n_local) * (n_local x m) = (n_local x m)
-    _parMatrixOps->multiply(_oldInvJacobian, _matrixV, _Wtil, _dimOffsets, getLSSystemRows(), getLSSystemRows(), getLSSystemCols(), false);
+    _parMatrixOps->multiply(_oldInvJacobian, _matrixV.matrix(), Wtil, _dimOffsets, getLSSystemRows(), getLSSystemRows(), getLSSystemCols(), false);
   }
 
   // W_til = (W-J_inv_n*V) = (W-V_tilde)
-  _Wtil *= -1.;
-  _Wtil = _Wtil + _matrixW;
+  Wtil *= -1.;
+  _matrixW.addTo(Wtil);
 
   _resetLS = false;
   //  e.stop(true);
@@ -417,7 +433,7 @@ void MVQNPostProcessing::buildJacobian()
   *  where Z = (V^T*V)^-1*V^T via QR-dec and back-substitution       dimension: (n x n) * (n x m) = (n x m),
   *  and W_til = (W - J_inv_n*V)                                     parallel:  (n_global x n_local) * (n_local x m) = (n_local x m)
   */
-  _parMatrixOps->multiply(_Wtil, Z, _invJacobian, _dimOffsets, getLSSystemRows(), getLSSystemCols(), getLSSystemRows());
+  _parMatrixOps->multiply(_Wtil.matrix(), Z, _invJacobian, _dimOffsets, getLSSystemRows(), getLSSystemCols(), getLSSystemRows());
   // --------
 
   // update Jacobian
@@ -450,8 +466,13 @@ void MVQNPostProcessing::computeNewtonUpdateEfficient(
 
   /**
    *  (1) computation of pseudo inverse Z = (V^TV)^-1 * V^T
+   *  Z is mapped onto preallocated storage, which only grows if the number of columns does.
    */
-  Eigen::MatrixXd Z(_qrV.cols(), _qrV.rows());
+  int Zsize = _qrV.cols() * _qrV.rows();
+  if (_pseudoInverseStorage.size() < Zsize) {
+    _pseudoInverseStorage.resize(std::max(Zsize, _maxIterationsUsed * _qrV.rows()));
+  }
+  Eigen::Map<Eigen::MatrixXd> Z(_pseudoInverseStorage.data(), _qrV.cols(), _qrV.rows());
   pseudoInverse(Z);
 
   /**
@@ -476,8 +497,10 @@ void MVQNPostProcessing::computeNewtonUpdateEfficient(
    *  dimension: (m x n) * (n x 1) = (m x 1),
    *  parallel:  (m x n_local) * (n x 1) = (m x 1)
    */
-  Eigen::VectorXd negativeResiduals = -_residuals;
-  Eigen::VectorXd r_til             = Eigen::VectorXd::Zero(getLSSystemCols());
+  Eigen::VectorXd &negativeResiduals = _workspace.negativeResiduals;
+  negativeResiduals                  = -_residuals;
+  auto r_til                         = _workspace.coefficients.head(getLSSystemCols());
+  r_til.setZero();
   _parMatrixOps->multiply(Z, negativeResiduals, r_til, getLSSystemCols(), getLSSystemRows(), 1); // --------
 
   /**
@@ -488,9 +511,9 @@ void MVQNPostProcessing::computeNewtonUpdateEfficient(
    *
    * Note: r_til is not distributed but locally stored on each proc (dimension m x 1)
    */
-  Eigen::VectorXd xUptmp(_residuals.size());
-  xUpdate = Eigen::VectorXd::Zero(_residuals.size());
-  xUptmp  = _Wtil * r_til; // local product, result is naturally distributed.
+  Eigen::VectorXd &xUptmp = _workspace.partialUpdate;
+  xUpdate.setZero();
+  xUptmp.noalias() = _Wtil.matrix() * r_til; // local product, result is naturally distributed.
 
   /**
    *  (5) xUp = J_prev * (-res) + Wtil*Z*(-res)
@@ -502,11 +525,12 @@ void MVQNPostProcessing::computeNewtonUpdateEfficient(
     for (int i = 0; i < (int) _WtilChunk.size(); i++) {
       int colsLSSystemBackThen = _pseudoInverseChunk[i].rows();
       assertion(colsLSSystemBackThen == _WtilChunk[i].cols(), colsLSSystemBackThen, _WtilChunk[i].cols());
-      r_til = Eigen::VectorXd::Zero(colsLSSystemBackThen);
+      auto r_til_q = _workspace.coefficients.head(colsLSSystemBackThen);
+      r_til_q.setZero();
       // multiply: r_til := Z^q * (-res) of size (m x 1) with m=#cols of LS at that time, result stored on each proc.
-      _parMatrixOps->multiply(_pseudoInverseChunk[i], negativeResiduals, r_til, colsLSSystemBackThen, getLSSystemRows(), 1);
+      _parMatrixOps->multiply(_pseudoInverseChunk[i], negativeResiduals, r_til_q, colsLSSystemBackThen, getLSSystemRows(), 1);
       // multiply: Wtil^q * r_til  dimensions: (n x m) * (m x 1), fully local and embarrassingly parallel
-      xUpdate += _WtilChunk[i] * r_til;
+      xUpdate += _WtilChunk[i] * r_til_q;
     }
 
     // imvj without restart is used, i.e., compute directly J_prev * (-res)
@@ -519,7 +543,7 @@ void MVQNPostProcessing::computeNewtonUpdateEfficient(
 
   // pending deletion: delete Wtil
   if (_firstIteration && _timestepsReused == 0 && not _forceInitialRelaxation) {
-    _Wtil.conservativeResize(0, 0);
+    _Wtil.clear();
     _resetLS = true;
   }
 }
@@ -548,7 +572,7 @@ void MVQNPostProcessing::computeNewtonUpdate(PostProcessing::DataMap &cplData, E
 	*  where Z = (V^T*V)^-1*V^T via QR-dec and back-substitution             dimension: (n x n) * (n x m) = (n x m),
 	*  and W_til = (W - J_inv_n*V)                                           parallel:  (n_global x n_local) * (n_local x m) = (n_local x m)
 	*/
-  _parMatrixOps->multiply(_Wtil, Z, _invJacobian, _dimOffsets, getLSSystemRows(), getLSSystemCols(), getLSSystemRows()); // --------
+  _parMatrixOps->multiply(_Wtil.matrix(), Z, _invJacobian, _dimOffsets, getLSSystemRows(), getLSSystemCols(), getLSSystemRows()); // --------
 
   // update Jacobian
   _invJacobian = _invJacobian + _oldInvJacobian;
@@ -570,7 +594,8 @@ void MVQNPostProcessing::restartIMVJ()
   //int used_storage = 0;
   //int theoreticalJ_storage = 2*getLSSystemRows()*_residuals.size() + 3*_residuals.size()*getLSSystemCols() + _residuals.size()*_residuals.size();
   //               ------------ RESTART SVD ------------
-  if (_imvjRestartType == MVQNPostProcessing::RS_SVD) {
+  // the low-rank mode is a restart SVD after every time step
+  if (_imvjRestartType == MVQNPostProcessing::RS_SVD || _imvjRestartType == MVQNPostProcessing::LOW_RANK) {
 
     // we need to compute the updated SVD of the scaled Jacobian matrix
     // |= APPLY PRECONDITIONING  J_prev = Wtil^q, Z^q  ===|
@@ -589,6 +614,9 @@ void MVQNPostProcessing::restartIMVJ()
 
     // perform M-1 rank-1 updates of the truncated SVD-dec of the Jacobian
     for (; q < (int) _WtilChunk.size(); q++) {
+      // time steps that converged within one iteration do not contribute
+      if (_WtilChunk[q].cols() == 0)
+        continue;
       // update SVD, i.e., PSI * SIGMA * PHI^T <-- PSI * SIGMA * PHI^T + Wtil^q * Z^q
       _svdJ.update(_WtilChunk[q], _pseudoInverseChunk[q].transpose());
       //  used_storage += 2*_WtilChunk.size();
@@ -616,14 +644,16 @@ void MVQNPostProcessing::restartIMVJ()
     int waste     = _svdJ.getWaste();
     _avgRank += rankAfter;
 
-    // store factorized truncated SVD of J
-    _WtilChunk.push_back(psi);
-    _pseudoInverseChunk.push_back(Z);
+    // store factorized truncated SVD of J, unless no time step contributed to it so far
+    if (_svdJ.isSVDinitialized()) {
+      _WtilChunk.push_back(psi);
+      _pseudoInverseChunk.push_back(Z);
 
-    // |= REVERT PRECONDITIONING  J_prev = Wtil^0, Z^0  ==|
-    _preconditioner->revert(_WtilChunk.front());
-    _preconditioner->apply(_pseudoInverseChunk.front(), true);
-    // |===================                             ==|
+      // |= REVERT PRECONDITIONING  J_prev = Wtil^0, Z^0  ==|
+      _preconditioner->revert(_WtilChunk.front());
+      _preconditioner->apply(_pseudoInverseChunk.front(), true);
+      // |===================                             ==|
+    }
 
     DEBUG("MVJ-RESTART, mode=SVD. Rank of truncated SVD of Jacobian " << rankAfter << ", new modes: " << rankAfter - rankBefore << ", truncated modes: " << waste << " avg rank: " << _avgRank / _nbRestarts);
     //double percentage = 100.0*used_storage/(double)theoreticalJ_storage;
@@ -651,6 +681,7 @@ void MVQNPostProcessing::restartIMVJ()
       _preconditioner->apply(_matrixW_RSLS);
 
       QRFactorization qr(_filter);
+      qr.setOrthogonalization(_orthogonalization);
       qr.setGlobalRows(getLSSystemRows());
       // for QR2-filter, the QR-dec is computed in qr-applyFilter()
       if (_filter != PostProcessing::QR2FILTER) {
@@ -726,7 +757,7 @@ void MVQNPostProcessing::restartIMVJ()
       assertion(colsLSSystemBackThen == _WtilChunk.front().cols(), colsLSSystemBackThen, _WtilChunk.front().cols());
       Eigen::MatrixXd ZV = Eigen::MatrixXd::Zero(colsLSSystemBackThen, _qrV.cols());
       // multiply: ZV := Z^q * V of size (m x m) with m=#cols, stored on each proc.
-      _parMatrixOps->multiply(_pseudoInverseChunk.front(), _matrixV, ZV, colsLSSystemBackThen, getLSSystemRows(), _qrV.cols());
+      _parMatrixOps->multiply(_pseudoInverseChunk.front(), _matrixV.matrix(), ZV, colsLSSystemBackThen, getLSSystemRows(), _qrV.cols());
       // multiply: Wtil^0 * (Z_0*V)  dimensions: (n x m) * (m x m), fully local and embarrassingly parallel
       Eigen::MatrixXd tmp = Eigen::MatrixXd::Zero(_qrV.rows(), _qrV.cols());
       tmp                 = _WtilChunk.front() * ZV;
@@ -786,18 +817,18 @@ void MVQNPostProcessing::specializedIterationsConverged(
 
     // |= REBUILD QR-dec if needed     ============|
     // apply scaling to V, V' := P * V (only needed to reset the QR-dec of V)
-    _preconditioner->apply(_matrixV);
+    _preconditioner->apply(_matrixV.matrix());
 
     if (_preconditioner->requireNewQR()) {
       if (not(_filter == PostProcessing::QR2FILTER)) { //for QR2 filter, there is no need to do this twice
-        _qrV.reset(_matrixV, getLSSystemRows());
+        _qrV.reset(_matrixV.matrix(), getLSSystemRows());
       }
       _preconditioner->newQRfulfilled();
     }
     // apply the configured filter to the LS system
     // as it changed in BaseQNPostProcessing::iterationsConverged()
     BaseQNPostProcessing::applyFilter();
-    _preconditioner->revert(_matrixV);
+    _preconditioner->revert(_matrixV.matrix());
     // |===================          ============|
 
     //              ------- RESTART/ JACOBIAN ASSEMBLY -------
@@ -812,13 +843,13 @@ void MVQNPostProcessing::specializedIterationsConverged(
 
       // push back unscaled pseudo Inverse, Wtil is also unscaled.
       // all objects in Wtil chunk and Z chunk are NOT PRECONDITIONED
-      _WtilChunk.push_back(_Wtil);
+      _WtilChunk.push_back(_Wtil.matrix());
       _pseudoInverseChunk.push_back(Z);
 
       /**
        *  Restart the IMVJ according to restart type
        */
-      if ((int) _WtilChunk.size() >= _chunkSize + 1) {
+      if ((int) _WtilChunk.size() >= _chunkSize + 1 || _imvjRestartType == LOW_RANK) {
 
         // < RESTART >
         _nbRestarts++;
@@ -859,7 +890,7 @@ void MVQNPostProcessing::removeMatrixColumn(
 
   // remove column from matrix _Wtil
   if (not _resetLS && not _alwaysBuildJacobian)
-    utils::removeColumnFromMatrix(_Wtil, columnIndex);
+    _Wtil.removeColumn(columnIndex);
 
   BaseQNPostProcessing::removeMatrixColumn(columnIndex);
 }
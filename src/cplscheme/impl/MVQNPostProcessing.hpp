@@ -38,6 +38,7 @@ public:
   static const int RS_LS      = 2;
   static const int RS_SVD     = 3;
   static const int RS_SLIDE   = 4;
+  static const int LOW_RANK   = 5;
 
   /**
    * @brief Constructor.
@@ -83,7 +84,10 @@ private:
   Eigen::MatrixXd _oldInvJacobian;
 
   /// @brief: stores the sub result (W-J_prev*V) for the current iteration
-  Eigen::MatrixXd _Wtil;
+  ColumnBuffer _Wtil;
+
+  /// @brief: storage of the pseudo inverse Z in the efficient update, holds up to _maxIterationsUsed x n entries
+  Eigen::VectorXd _pseudoInverseStorage;
 
   /// @brief: stores all Wtil matrices within the current chunk of the imvj restart mode, disabled if _imvjRestart = false.
   std::vector<Eigen::MatrixXd> _WtilChunk;
@@ -123,6 +127,7 @@ private:
     *  - RS-ZERO:    imvj is run in restart-mode. After M time steps all stored matrices are dropped
     *  - RS-LS:      imvj in restart-mode. After M time steps restart with LS approximation for initial Jacobian
     *  - RS-SVD:     imvj in restart mode. After M time steps, update of an truncated SVD of the Jacobian.
+    *  - LOW_RANK:   imvj without explicit Jacobian. J_prev is the truncated SVD, updated after every time step.
     */
   int _imvjRestartType;
 
@@ -180,7 +185,7 @@ private:
 
   /** @brief: computes the pseudo inverse of V multiplied with V^T, i.e., Z = (V^TV)^-1V^T via QR-dec
     */
-  void pseudoInverse(Eigen::MatrixXd &pseudoInverse);
+  void pseudoInverse(Eigen::Ref<Eigen::MatrixXd> pseudoInverse);
 
   /** @brief: computes a explicit representation of the Jacobian, i.e., n x n matrix
     */
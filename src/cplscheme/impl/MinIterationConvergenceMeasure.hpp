@@ -20,10 +20,15 @@ public:
 
   virtual void newMeasurementSeries();
 
-  virtual void measure(
+  virtual void addNorms(
       const Eigen::VectorXd &oldValues,
       const Eigen::VectorXd &newValues,
-      const Eigen::VectorXd &designSpecification)
+      const Eigen::VectorXd &designSpecification,
+      NormBatch &            batch)
+  {
+  }
+
+  virtual void evaluate(const NormBatch &batch)
   {
     TRACE();
     _currentIteration++;
@@ -0,0 +1,157 @@
+#include "MixedPrecisionColumnBuffer.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice
+{
+namespace cplscheme
+{
+namespace impl
+{
+
+MixedPrecisionColumnBuffer::MixedPrecisionColumnBuffer()
+    : _double(),
+      _single(),
+      _isSinglePrecision(false)
+{
+}
+
+void MixedPrecisionColumnBuffer::setSinglePrecision(
+    bool singlePrecision)
+{
+  assertion(cols() == 0, cols());
+  _isSinglePrecision = singlePrecision;
+}
+
+void MixedPrecisionColumnBuffer::reserve(
+    int rows,
+    int capacity)
+{
+  if (_isSinglePrecision) {
+    _single.reserve(rows, capacity);
+  } else {
+    _double.reserve(rows, capacity);
+  }
+}
+
+void MixedPrecisionColumnBuffer::pushFront(
+    const Eigen::VectorXd &column)
+{
+  if (_isSinglePrecision) {
+    _single.pushFront(column.cast<float>());
+  } else {
+    _double.pushFront(column);
+  }
+}
+
+void MixedPrecisionColumnBuffer::popBack()
+{
+  if (_isSinglePrecision) {
+    _single.popBack();
+  } else {
+    _double.popBack();
+  }
+}
+
+void MixedPrecisionColumnBuffer::removeColumn(
+    int index)
+{
+  if (_isSinglePrecision) {
+    _single.removeColumn(index);
+  } else {
+    _double.removeColumn(index);
+  }
+}
+
+void MixedPrecisionColumnBuffer::clear()
+{
+  if (_isSinglePrecision) {
+    _single.clear();
+  } else {
+    _double.clear();
+  }
+}
+
+void MixedPrecisionColumnBuffer::assign(
+    const Eigen::MatrixXd &matrix)
+{
+  if (_isSinglePrecision) {
+    _single.assign(matrix.cast<float>());
+  } else {
+    _double.assign(matrix);
+  }
+}
+
+void MixedPrecisionColumnBuffer::assign(
+    const MixedPrecisionColumnBuffer &other)
+{
+  clear();
+  _isSinglePrecision = other._isSinglePrecision;
+  if (_isSinglePrecision) {
+    _single.assign(other._single.matrix());
+  } else {
+    _double.assign(other._double.matrix());
+  }
+}
+
+Eigen::VectorXd MixedPrecisionColumnBuffer::col(
+    int index) const
+{
+  assertion(index >= 0 && index < cols(), index, cols());
+  if (_isSinglePrecision) {
+    return _single.col(index).cast<double>();
+  }
+  return _double.col(index);
+}
+
+void MixedPrecisionColumnBuffer::copyCol(
+    int                         index,
+    Eigen::Ref<Eigen::VectorXd> column) const
+{
+  assertion(index >= 0 && index < cols(), index, cols());
+  assertion(column.size() == rows(), column.size(), rows());
+  if (_isSinglePrecision) {
+    column = _single.col(index).cast<double>();
+  } else {
+    column = _double.col(index);
+  }
+}
+
+Eigen::MatrixXd MixedPrecisionColumnBuffer::toMatrix() const
+{
+  if (_isSinglePrecision) {
+    return _single.matrix().cast<double>();
+  }
+  return _double.matrix();
+}
+
+void MixedPrecisionColumnBuffer::multiply(
+    const Eigen::Ref<const Eigen::VectorXd> &coefficients,
+    Eigen::Ref<Eigen::VectorXd>              result) const
+{
+  assertion(coefficients.size() == cols(), coefficients.size(), cols());
+  assertion(result.size() == rows(), result.size(), rows());
+  if (_isSinglePrecision) {
+    // column-wise to avoid a double precision copy of the whole matrix
+    result.setZero();
+    for (int i = 0; i < _single.cols(); i++) {
+      result.noalias() += coefficients(i) * _single.col(i).cast<double>();
+    }
+  } else {
+    result.noalias() = _double.matrix() * coefficients;
+  }
+}
+
+void MixedPrecisionColumnBuffer::addTo(
+    Eigen::Ref<Eigen::MatrixXd> target) const
+{
+  assertion(target.rows() == rows(), target.rows(), rows());
+  assertion(target.cols() == cols(), target.cols(), cols());
+  if (_isSinglePrecision) {
+    target += _single.matrix().cast<double>();
+  } else {
+    target += _double.matrix();
+  }
+}
+}
+}
+} // namespace precice, cplscheme, impl
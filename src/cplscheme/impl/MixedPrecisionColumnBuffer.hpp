@@ -0,0 +1,95 @@
+#pragma once
+
+#include <Eigen/Core>
+#include "ColumnBuffer.hpp"
+
+namespace precice
+{
+namespace cplscheme
+{
+namespace impl
+{
+
+/**
+ * @brief Column store that optionally keeps its columns in single precision.
+ *
+ * Holds a difference matrix of the quasi-Newton post-processings, which only enters the
+ * update linearly, e.g., W in x = x~ + W*c. In single precision mode, the columns are rounded
+ * to float when they are inserted, which halves the memory footprint and the bandwidth of
+ * the products. All reads convert back to double and all products accumulate in double,
+ * such that the only error is the rounding of the stored entries.
+ *
+ * As the storage type is chosen at runtime, the logical matrix is not accessible as a view.
+ * Instead, the buffer offers the operations needed by the post-processings.
+ */
+class MixedPrecisionColumnBuffer
+{
+public:
+  MixedPrecisionColumnBuffer();
+
+  /// Selects single precision storage, only possible as long as no columns are stored.
+  void setSinglePrecision(bool singlePrecision);
+
+  bool isSinglePrecision() const
+  {
+    return _isSinglePrecision;
+  }
+
+  /// Preallocates storage for the given number of rows and columns, see ColumnBuffer::reserve().
+  void reserve(int rows, int capacity);
+
+  /// Inserts a column at position 0, i.e., all other columns shift right.
+  void pushFront(const Eigen::VectorXd &column);
+
+  /// Deletes the column at position cols()-1.
+  void popBack();
+
+  /// Deletes the column at the given position.
+  void removeColumn(int index);
+
+  /// Deletes all columns, keeps the storage.
+  void clear();
+
+  /// Replaces the content by the columns of the given matrix.
+  void assign(const Eigen::MatrixXd &matrix);
+
+  /// Replaces the content by a copy of other, including its precision.
+  void assign(const MixedPrecisionColumnBuffer &other);
+
+  /// Returns a copy of the column at the given logical position.
+  Eigen::VectorXd col(int index) const;
+
+  /// Copies the column at the given logical position into column, which has to be of size rows().
+  void copyCol(int index, Eigen::Ref<Eigen::VectorXd> column) const;
+
+  /// Returns a copy of the logical matrix.
+  Eigen::MatrixXd toMatrix() const;
+
+  /// Computes result = M * coefficients.
+  void multiply(const Eigen::Ref<const Eigen::VectorXd> &coefficients, Eigen::Ref<Eigen::VectorXd> result) const;
+
+  /// Computes target += M.
+  void addTo(Eigen::Ref<Eigen::MatrixXd> target) const;
+
+  int rows() const
+  {
+    return _isSinglePrecision ? _single.rows() : _double.rows();
+  }
+
+  int cols() const
+  {
+    return _isSinglePrecision ? _single.cols() : _double.cols();
+  }
+
+private:
+  /// Storage in double precision, used by default.
+  ColumnBuffer _double;
+
+  /// Storage in single precision.
+  BasicColumnBuffer<float> _single;
+
+  bool _isSinglePrecision;
+};
+}
+}
+} // namespace precice, cplscheme, impl
@@ -0,0 +1,57 @@
+#include "NormBatch.hpp"
+#include <cmath>
+#include "utils/MasterSlave.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice
+{
+namespace cplscheme
+{
+namespace impl
+{
+
+NormBatch::NormBatch()
+    : _localSquaredNorms(),
+      _globalSquaredNorms(),
+      _isReduced(false)
+{
+}
+
+int NormBatch::add(
+    const Eigen::Ref<const Eigen::VectorXd> &localPart)
+{
+  assertion(not _isReduced);
+  _localSquaredNorms.push_back(localPart.squaredNorm());
+  return _localSquaredNorms.size() - 1;
+}
+
+void NormBatch::reduce()
+{
+  assertion(not _isReduced);
+  _globalSquaredNorms.resize(_localSquaredNorms.size());
+  if ((utils::MasterSlave::_masterMode || utils::MasterSlave::_slaveMode) && not _localSquaredNorms.empty()) {
+    // the local squared norms are modified, do not use afterwards
+    utils::MasterSlave::allreduceSum(_localSquaredNorms.data(), _globalSquaredNorms.data(), _localSquaredNorms.size());
+  } else {
+    _globalSquaredNorms = _localSquaredNorms;
+  }
+  _isReduced = true;
+}
+
+double NormBatch::norm(
+    int handle) const
+{
+  assertion(_isReduced);
+  assertion(handle >= 0 && handle < size(), handle, size());
+  return std::sqrt(_globalSquaredNorms[handle]);
+}
+
+void NormBatch::clear()
+{
+  _localSquaredNorms.clear();
+  _globalSquaredNorms.clear();
+  _isReduced = false;
+}
+}
+}
+} // namespace precice, cplscheme, impl
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <vector>
+
+namespace precice
+{
+namespace cplscheme
+{
+namespace impl
+{
+
+/**
+ * @brief Computes the l2-norms of several distributed vectors with a single global reduction.
+ *
+ * Each utils::MasterSlave::l2norm() is a global reduction of its own. Users that need several
+ * norms at the same time add the local parts of the vectors, reduce all squared norms at once,
+ * and query the finalized norms afterwards:
+ * -# call add() for every vector, keep the returned handle
+ * -# call reduce() on all ranks
+ * -# retrieve the norms via norm(handle)
+ */
+class NormBatch
+{
+public:
+  NormBatch();
+
+  /**
+   * @brief Registers the local part of a distributed vector.
+   *
+   * @return Handle, i.e., the position of the vector in the batch, to retrieve its global l2-norm after reduce().
+   */
+  int add(const Eigen::Ref<const Eigen::VectorXd> &localPart);
+
+  /// Sums up the squared norms of all registered vectors over all ranks.
+  void reduce();
+
+  /// Returns the global l2-norm of the vector with the given handle.
+  double norm(int handle) const;
+
+  /// Returns the number of registered vectors.
+  int size() const
+  {
+    return _localSquaredNorms.size();
+  }
+
+  /// Removes all registered vectors.
+  void clear();
+
+private:
+  std::vector<double> _localSquaredNorms;
+
+  std::vector<double> _globalSquaredNorms;
+
+  bool _isReduced;
+};
+}
+}
+} // namespace precice, cplscheme, impl
@@ -7,7 +7,9 @@
 #include "logging/Logger.hpp"
 #include "utils/Globals.hpp"
 #include "utils/MasterSlave.hpp"
+#include "utils/ThreadPool.hpp"
 #include <Eigen/Core>
+#include <algorithm>
 
 namespace precice
 {
@@ -29,12 +31,12 @@ public:
                   com::PtrCommunication rightComm,
                   bool                  needcyclicComm);
 
-  template <typename Derived1, typename Derived2>
+  template <typename Derived1, typename Derived2, typename Derived3>
   void multiply(
-      Eigen::PlainObjectBase<Derived1> &leftMatrix,
-      Eigen::PlainObjectBase<Derived2> &rightMatrix,
-      Eigen::PlainObjectBase<Derived2> &result,
-      const std::vector<int> &          offsets,
+      const Eigen::MatrixBase<Derived1> &leftMatrix,
+      const Eigen::MatrixBase<Derived2> &rightMatrix,
+      Eigen::MatrixBase<Derived3> &       result,
+      const std::vector<int> &           offsets,
       int p, int q, int r,
       bool dotProductComputation = true)
   {
@@ -90,7 +92,7 @@ public:
   void multiply(
       const Eigen::MatrixBase<Derived1> &leftMatrix,
       const Eigen::MatrixBase<Derived2> &rightMatrix,
-      Eigen::PlainObjectBase<Derived3> & result,
+      Eigen::MatrixBase<Derived3> &       result,
       int p, int q, int r)
   {
     TRACE();
@@ -99,14 +101,17 @@ public:
     assertion(result.rows() == p, result.rows(), p);
     assertion(result.cols() == r, result.cols(), r);
 
-    Eigen::MatrixXd localResult(result.rows(), result.cols());
-    localResult.noalias() = leftMatrix * rightMatrix;
-
     // if serial computation on single processor, i.e, no master-slave mode
     if (not utils::MasterSlave::_masterMode && not utils::MasterSlave::_slaveMode) {
-      result = localResult;
+      result.noalias() = leftMatrix * rightMatrix;
     } else {
-      utils::MasterSlave::allreduceSum(localResult.data(), result.data(), localResult.size());
+      // the local products are stored in a buffer, which only grows if the result does
+      if (_localResult.size() < result.size()) {
+        _localResult.resize(result.size());
+      }
+      Eigen::Map<Eigen::MatrixXd> localResult(_localResult.data(), result.rows(), result.cols());
+      localResult.noalias() = leftMatrix * rightMatrix;
+      utils::MasterSlave::allreduceSum(localResult.data(), result.derived().data(), localResult.size());
     }
   }
 
@@ -115,12 +120,12 @@ private:
   static logging::Logger _log;
 
   // @brief multiplies matrices based on a cyclic communication and block-wise matrix multiplication with a quadratic result matrix
-  template <typename Derived1, typename Derived2>
+  template <typename Derived1, typename Derived2, typename Derived3>
   void _multiplyNN(
-      Eigen::PlainObjectBase<Derived1> &leftMatrix,
-      Eigen::PlainObjectBase<Derived2> &rightMatrix,
-      Eigen::PlainObjectBase<Derived2> &result,
-      const std::vector<int> &          offsets,
+      const Eigen::MatrixBase<Derived1> &leftMatrix,
+      const Eigen::MatrixBase<Derived2> &rightMatrix,
+      Eigen::MatrixBase<Derived3> &       result,
+      const std::vector<int> &           offsets,
       int p, int q, int r)
   {
     TRACE();
@@ -140,91 +145,110 @@ private:
     assertion(leftMatrix.rows() == rightMatrix.cols(), leftMatrix.rows(), rightMatrix.cols());
     assertion(result.rows() == p, result.rows(), p);
 
-    //int nextProc = (utils::MasterSlave::_rank + 1) % utils::MasterSlave::_size;
-    int prevProc = (utils::MasterSlave::_rank - 1 < 0) ? utils::MasterSlave::_size - 1 : utils::MasterSlave::_rank - 1;
-    int rows_rcv = (prevProc > 0) ? offsets[prevProc + 1] - offsets[prevProc] : offsets[1];
-    //Eigen::MatrixXd leftMatrix_rcv = Eigen::MatrixXd::Zero(rows_rcv, q);
-    Eigen::MatrixXd leftMatrix_rcv(rows_rcv, q);
+    int size = utils::MasterSlave::_size;
+    int rank = utils::MasterSlave::_rank;
+
+    // number of rows of the block of leftMatrix (W_til) that is owned by the given proc
+    auto rowsOf = [&offsets](int proc) { return offsets[proc + 1] - offsets[proc]; };
+    // proc that owned the block of leftMatrix at the very beginning, which is held in the given cycle
+    auto sourceOf = [rank, size](int cycle) { return (rank - cycle < 0) ? size + (rank - cycle) : rank - cycle; };
+
+    // Double buffering: in each cycle, the block of leftMatrix received in the last cycle is handed over
+    // to the next proc and multiplied, while the block for the next cycle is received in the other buffer.
+    // Both buffers are large enough for the largest block, the blocks are stored contiguously at their front.
+    int maxRows = 0;
+    for (int proc = 0; proc < size; proc++) {
+      maxRows = std::max(maxRows, rowsOf(proc));
+    }
+    Eigen::VectorXd buffers[2] = {Eigen::VectorXd(maxRows * q), Eigen::VectorXd(maxRows * q)};
 
     com::PtrRequest requestSend;
     com::PtrRequest requestRcv;
 
+    // leftMatrix is sent as a whole, i.e., its columns must be stored contiguously
+    assertion(leftMatrix.derived().outerStride() == leftMatrix.rows(), leftMatrix.derived().outerStride(), leftMatrix.rows());
+
     // initiate asynchronous send operation of leftMatrix (W_til) --> nextProc (this data is needed in cycle 1)    dim: n_local x cols
     if (leftMatrix.size() > 0)
-      requestSend = _cyclicCommRight->aSend(leftMatrix.data(), leftMatrix.size(), 0);
+      requestSend = _cyclicCommRight->aSend(leftMatrix.derived().data(), leftMatrix.size(), 0);
 
     // initiate asynchronous receive operation for leftMatrix (W_til) from previous processor --> W_til      dim: rows_rcv x cols
-    if (leftMatrix_rcv.size() > 0)
-      requestRcv = _cyclicCommLeft->aReceive(leftMatrix_rcv.data(), leftMatrix_rcv.size(), 0);
+    if (size > 1 && rowsOf(sourceOf(1)) * q > 0)
+      requestRcv = _cyclicCommLeft->aReceive(buffers[0].data(), rowsOf(sourceOf(1)) * q, 0);
 
     // compute diagonal blocks where all data is local and no communication is needed
     // compute block matrices of J_inv of size (n_til x n_til), n_til = local n
-    Eigen::MatrixXd diagBlock(leftMatrix.rows(), leftMatrix.rows());
-    diagBlock.noalias() = leftMatrix * rightMatrix;
-
-    // set block at corresponding row-index on proc
-    int off = offsets[utils::MasterSlave::_rank];
-    assertion(result.cols() == diagBlock.cols(), result.cols(), diagBlock.cols());
-    result.block(off, 0, diagBlock.rows(), diagBlock.cols()) = diagBlock;
+    assertion(result.cols() == rightMatrix.cols(), result.cols(), rightMatrix.cols());
+    _multiplyBlock(leftMatrix, rightMatrix, result.block(offsets[rank], 0, leftMatrix.rows(), rightMatrix.cols()));
 
     /**
 		 * cyclic send-receive operation
 		 */
-    for (int cycle = 1; cycle < utils::MasterSlave::_size; cycle++) {
+    for (int cycle = 1; cycle < size; cycle++) {
+      Eigen::VectorXd &current = buffers[(cycle - 1) % 2];
+      Eigen::VectorXd &next    = buffers[cycle % 2];
 
-      // wait until W_til from previous processor is fully received
-      if (requestSend != NULL)
-        requestSend->wait();
-      if (requestRcv != NULL)
+      // wait until W_til from previous processor is fully received and the last send,
+      // which might still read from the buffer of the next cycle, has completed
+      if (requestRcv != nullptr)
         requestRcv->wait();
+      if (requestSend != nullptr)
+        requestSend->wait();
+      requestRcv  = nullptr;
+      requestSend = nullptr;
 
-      // leftMatrix (leftMatrix_rcv) is available - needed for local multiplication and hand over to next proc
-      Eigen::MatrixXd leftMatrix_copy(leftMatrix_rcv);
-
-      // initiate async send to hand over leftMatrix (W_til) to the next proc (this data will be needed in the next cycle)    dim: n_local x cols
-      if (cycle < utils::MasterSlave::_size - 1) {
-        if (leftMatrix_copy.size() > 0)
-          requestSend = _cyclicCommRight->aSend(leftMatrix_copy.data(), leftMatrix_copy.size(), 0);
-      }
-
-      // compute proc that owned leftMatrix_rcv (Wtil_rcv) at the very beginning for each cylce
-      int sourceProc_nextCycle = (utils::MasterSlave::_rank - (cycle + 1) < 0) ? utils::MasterSlave::_size + (utils::MasterSlave::_rank - (cycle + 1)) : utils::MasterSlave::_rank - (cycle + 1);
-
-      int sourceProc = (utils::MasterSlave::_rank - cycle < 0) ? utils::MasterSlave::_size + (utils::MasterSlave::_rank - cycle) : utils::MasterSlave::_rank - cycle;
+      int rows_rcv = rowsOf(sourceOf(cycle));
 
-      int rows_rcv_nextCycle = (sourceProc_nextCycle > 0) ? offsets[sourceProc_nextCycle + 1] - offsets[sourceProc_nextCycle] : offsets[1];
-      rows_rcv               = (sourceProc > 0) ? offsets[sourceProc + 1] - offsets[sourceProc] : offsets[1];
-      leftMatrix_rcv         = Eigen::MatrixXd::Zero(rows_rcv_nextCycle, q);
+      if (cycle < size - 1) {
+        // initiate async send to hand over leftMatrix (W_til) to the next proc (this data will be needed in the next cycle)    dim: n_local x cols
+        if (rows_rcv * q > 0)
+          requestSend = _cyclicCommRight->aSend(current.data(), rows_rcv * q, 0);
 
-      // initiate asynchronous receive operation for leftMatrix (W_til) from previous processor --> W_til (this data is needed in the next cycle)
-      if (cycle < utils::MasterSlave::_size - 1) {
-        if (leftMatrix_rcv.size() > 0) // only receive data, if data has been sent
-          requestRcv = _cyclicCommLeft->aReceive(leftMatrix_rcv.data(), leftMatrix_rcv.size(), 0);
+        // initiate asynchronous receive operation for leftMatrix (W_til) from previous processor --> W_til (this data is needed in the next cycle)
+        int rows_rcv_nextCycle = rowsOf(sourceOf(cycle + 1));
+        if (rows_rcv_nextCycle * q > 0) // only receive data, if data has been sent
+          requestRcv = _cyclicCommLeft->aReceive(next.data(), rows_rcv_nextCycle * q, 0);
       }
 
-      if (requestSend != NULL)
-        requestSend->wait();
-      // compute block with new local data
-      Eigen::MatrixXd block(rows_rcv, rightMatrix.cols());
-      block.noalias() = leftMatrix_copy * rightMatrix;
-
+      // compute block with new local data, overlapped with the communication of the next block
       // set block at corresponding index in J_inv
       // the row-offset of the current block is determined by the proc that sends the part of the W_til matrix
       // note: the direction and ordering of the cyclic sending operation is chosen s.t. the computed block is
       //       local on the current processor (in J_inv).
-      off = offsets[sourceProc];
-      assertion(result.cols() == block.cols(), result.cols(), block.cols());
-      result.block(off, 0, block.rows(), block.cols()) = block;
+      Eigen::Map<const Eigen::MatrixXd> block(current.data(), rows_rcv, q);
+      _multiplyBlock(block, rightMatrix, result.block(offsets[sourceOf(cycle)], 0, rows_rcv, rightMatrix.cols()));
     }
+
+    // the last cycle does not communicate, all requests are completed
+    assertion(requestSend == nullptr);
+    assertion(requestRcv == nullptr);
+  }
+
+  /**
+   * @brief Computes the local block product result = leftBlock * rightMatrix.
+   *
+   * The rows of the block are distributed among the threads of the utils::ThreadPool. Every row
+   * costs a dot product with each column of rightMatrix, which is passed as the cost per row.
+   */
+  template <typename Derived1, typename Derived2, typename Derived3>
+  void _multiplyBlock(
+      const Eigen::MatrixBase<Derived1> &leftBlock,
+      const Eigen::MatrixBase<Derived2> &rightMatrix,
+      Eigen::Block<Derived3>             result)
+  {
+    int cost = std::max<int>(1, leftBlock.cols() * rightMatrix.cols());
+    utils::ThreadPool::getInstance().parallelFor(leftBlock.rows(), [&](int begin, int end) {
+      result.middleRows(begin, end - begin).noalias() = leftBlock.middleRows(begin, end - begin) * rightMatrix;
+    }, cost);
   }
 
   // @brief multiplies matrices based on a dot-product computation with a rectangular result matrix
-  template <typename Derived1, typename Derived2>
+  template <typename Derived1, typename Derived2, typename Derived3>
   void _multiplyNM_dotProduct(
-      Eigen::PlainObjectBase<Derived1> &leftMatrix,
-      Eigen::PlainObjectBase<Derived2> &rightMatrix,
-      Eigen::PlainObjectBase<Derived2> &result,
-      const std::vector<int> &          offsets,
+      const Eigen::MatrixBase<Derived1> &leftMatrix,
+      const Eigen::MatrixBase<Derived2> &rightMatrix,
+      Eigen::MatrixBase<Derived3> &       result,
+      const std::vector<int> &           offsets,
       int p, int q, int r)
   {
     TRACE();
@@ -256,12 +280,12 @@ private:
   }
 
   /// Multiplies matrices based on a SAXPY-like block-wise computation with a rectangular result matrix of dimension n x m
-  template <typename Derived1, typename Derived2>
+  template <typename Derived1, typename Derived2, typename Derived3>
   void _multiplyNM_block(
-      Eigen::PlainObjectBase<Derived1> &leftMatrix,
-      Eigen::PlainObjectBase<Derived2> &rightMatrix,
-      Eigen::PlainObjectBase<Derived2> &result,
-      const std::vector<int> &          offsets,
+      const Eigen::MatrixBase<Derived1> &leftMatrix,
+      const Eigen::MatrixBase<Derived2> &rightMatrix,
+      Eigen::MatrixBase<Derived3> &       result,
+      const std::vector<int> &           offsets,
       int p, int q, int r)
   {
     TRACE();
@@ -286,7 +310,7 @@ private:
     // slaves wait to receive their local result
     if (utils::MasterSlave::_slaveMode) {
       if (result.size() > 0)
-        utils::MasterSlave::_communication->receive(result.data(), result.size(), 0);
+        utils::MasterSlave::_communication->receive(result.derived().data(), result.size(), 0);
     }
 
     // master distributes the sub blocks of the results
@@ -315,6 +339,9 @@ private:
   com::PtrCommunication _cyclicCommRight;
 
   bool _needCycliclComm;
+
+  /// Local contributions of the product with a result, which is stored on each proc.
+  Eigen::VectorXd _localResult;
 };
 }
 }
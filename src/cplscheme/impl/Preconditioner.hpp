@@ -6,6 +6,7 @@
 #include "utils/Globals.hpp"
 #include "utils/Helpers.hpp"
 #include "utils/MasterSlave.hpp"
+#include "utils/ThreadPool.hpp"
 
 namespace precice
 {
@@ -67,23 +68,20 @@ public:
    * @brief Apply preconditioner to matrix
    * @param transpose: false = from left, true = from right
    */
-  void apply(Eigen::MatrixXd &M, bool transpose)
+  void apply(Eigen::Ref<Eigen::MatrixXd> M, bool transpose)
   {
     TRACE();
     if (transpose) {
       assertion(M.cols() == (int) _weights.size(), M.cols(), _weights.size());
-      for (int i = 0; i < M.cols(); i++) {
-        for (int j = 0; j < M.rows(); j++) {
-          M(j, i) *= _weights[i];
+      utils::ThreadPool::getInstance().parallelFor(M.rows(), [&](int begin, int end) {
+        for (int i = 0; i < M.cols(); i++) {
+          for (int j = begin; j < end; j++) {
+            M(j, i) *= _weights[i];
+          }
         }
-      }
+      });
     } else {
-      assertion(M.rows() == (int) _weights.size(), M.rows(), (int) _weights.size());
-      for (int i = 0; i < M.cols(); i++) {
-        for (int j = 0; j < M.rows(); j++) {
-          M(j, i) *= _weights[j];
-        }
-      }
+      apply(M);
     }
   }
 
@@ -91,41 +89,40 @@ public:
    * @brief Apply inverse preconditioner to matrix
    * @param transpose: false = from left, true = from right
    */
-  void revert(Eigen::MatrixXd &M, bool transpose)
+  void revert(Eigen::Ref<Eigen::MatrixXd> M, bool transpose)
   {
     TRACE();
     //assertion(_needsGlobalWeights);
     if (transpose) {
       assertion(M.cols() == (int) _invWeights.size());
-      for (int i = 0; i < M.cols(); i++) {
-        for (int j = 0; j < M.rows(); j++) {
-          M(j, i) *= _invWeights[i];
+      utils::ThreadPool::getInstance().parallelFor(M.rows(), [&](int begin, int end) {
+        for (int i = 0; i < M.cols(); i++) {
+          for (int j = begin; j < end; j++) {
+            M(j, i) *= _invWeights[i];
+          }
         }
-      }
+      });
     } else {
-      assertion(M.rows() == (int) _invWeights.size(), M.rows(), (int) _invWeights.size());
-      for (int i = 0; i < M.cols(); i++) {
-        for (int j = 0; j < M.rows(); j++) {
-          M(j, i) *= _invWeights[j];
-        }
-      }
+      revert(M);
     }
   }
 
   /**
    * @brief To transform physical values to balanced values. Matrix version
    */
-  void apply(Eigen::MatrixXd &M)
+  void apply(Eigen::Ref<Eigen::MatrixXd> M)
   {
     TRACE();
     assertion(M.rows() == (int) _weights.size(), M.rows(), (int) _weights.size());
 
-    // scale matrix M
-    for (int i = 0; i < M.cols(); i++) {
-      for (int j = 0; j < M.rows(); j++) {
-        M(j, i) *= _weights[j];
+    // scale matrix M, the rows are distributed among the threads
+    utils::ThreadPool::getInstance().parallelFor(M.rows(), [&](int begin, int end) {
+      for (int i = 0; i < M.cols(); i++) {
+        for (int j = begin; j < end; j++) {
+          M(j, i) *= _weights[j];
+        }
       }
-    }
+    });
   }
 
   /**
@@ -138,26 +135,30 @@ public:
     assertion(v.size() == (int) _weights.size());
 
     // scale residual
-    for (int j = 0; j < v.size(); j++) {
-      v[j] *= _weights[j];
-    }
+    utils::ThreadPool::getInstance().parallelFor(v.size(), [&](int begin, int end) {
+      for (int j = begin; j < end; j++) {
+        v[j] *= _weights[j];
+      }
+    });
   }
 
   /**
      * @brief To transform balanced values back to physical values. Matrix version
      */
-  void revert(Eigen::MatrixXd &M)
+  void revert(Eigen::Ref<Eigen::MatrixXd> M)
   {
     TRACE();
 
     assertion(M.rows() == (int) _weights.size());
 
-    // scale matrix M
-    for (int i = 0; i < M.cols(); i++) {
-      for (int j = 0; j < M.rows(); j++) {
-        M(j, i) *= _invWeights[j];
+    // scale matrix M, the rows are distributed among the threads
+    utils::ThreadPool::getInstance().parallelFor(M.rows(), [&](int begin, int end) {
+      for (int i = 0; i < M.cols(); i++) {
+        for (int j = begin; j < end; j++) {
+          M(j, i) *= _invWeights[j];
+        }
       }
-    }
+    });
   }
 
   /**
@@ -170,9 +171,11 @@ public:
     assertion(v.size() == (int) _weights.size());
 
     // scale residual
-    for (int j = 0; j < v.size(); j++) {
-      v[j] *= _invWeights[j];
-    }
+    utils::ThreadPool::getInstance().parallelFor(v.size(), [&](int begin, int end) {
+      for (int j = begin; j < end; j++) {
+        v[j] *= _invWeights[j];
+      }
+    });
   }
 
   /**
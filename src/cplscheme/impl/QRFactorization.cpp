@@ -32,9 +32,15 @@ QRFactorization::QRFactorization(
 
     : _Q(Q),
       _R(R),
+      _v(),
+      _u(),
+      _r(),
+      _s(),
+      _localProjection(),
       _rows(rows),
       _cols(cols),
       _filter(filter),
+      _orthogonalization(MGS),
       _omega(omega),
       _theta(theta),
       _sigma(sigma),
@@ -59,9 +65,15 @@ QRFactorization::QRFactorization(
     double          sigma)
     : _Q(),
       _R(),
+      _v(),
+      _u(),
+      _r(),
+      _s(),
+      _localProjection(),
       _rows(A.rows()),
       _cols(0),
       _filter(filter),
+      _orthogonalization(MGS),
       _omega(omega),
       _theta(theta),
       _sigma(sigma),
@@ -75,8 +87,8 @@ QRFactorization::QRFactorization(
     insertColumn(k, v);
   }
   //assertion(_R.rows() == _cols, _R.rows(), _cols);
-  assertion(_R.cols() == _cols, _R.cols(), _cols);
-  assertion(_Q.cols() == _cols, _Q.cols(), _cols);
+  assertion(_R.cols() >= _cols, _R.cols(), _cols);
+  assertion(_Q.cols() >= _cols, _Q.cols(), _cols);
   assertion(_Q.rows() == _rows, _Q.rows(), _rows);
   assertion(_cols == m, _cols, m);
 }
@@ -91,9 +103,15 @@ QRFactorization::QRFactorization(
     double sigma)
     : _Q(),
       _R(),
+      _v(),
+      _u(),
+      _r(),
+      _s(),
+      _localProjection(),
       _rows(0),
       _cols(0),
       _filter(filter),
+      _orthogonalization(MGS),
       _omega(omega),
       _theta(theta),
       _sigma(sigma),
@@ -103,7 +121,7 @@ QRFactorization::QRFactorization(
 {
 }
 
-void QRFactorization::applyFilter(double singularityLimit, std::vector<int> &delIndices, Eigen::MatrixXd &V)
+void QRFactorization::applyFilter(double singularityLimit, std::vector<int> &delIndices, Eigen::Ref<const Eigen::MatrixXd> V)
 {
   TRACE();
   delIndices.resize(0);
@@ -124,7 +142,7 @@ void QRFactorization::applyFilter(double singularityLimit, std::vector<int> &del
           if (index >= cols())
             break;
           assertion(index < _cols, index, _cols);
-          double factor = (_filter == PostProcessing::QR1FILTER_ABS) ? 1.0 : _R.norm();
+          double factor = (_filter == PostProcessing::QR1FILTER_ABS) ? 1.0 : matrixR().norm();
           if (std::fabs(_R(index, index)) < singularityLimit * factor) {
 
             linearDependence = true;
@@ -141,16 +159,14 @@ void QRFactorization::applyFilter(double singularityLimit, std::vector<int> &del
       }
     }
   } else if (_filter == PostProcessing::QR2FILTER) {
-    _Q.resize(0, 0);
-    _R.resize(0, 0);
+    // rebuild the factorization within the existing storage of Q and R
     _cols = 0;
     _rows = V.rows();
     // starting with the most recent input/output information, i.e., the latest column
     // which is at position 0 in _matrixV (latest information is never filtered out!)
     for (int k = 0; k < V.cols(); k++) {
-      Eigen::VectorXd v = V.col(k);
       // this is the same as pushBack(v) as _cols grows within the insertion process
-      bool inserted = insertColumn(_cols, v, singularityLimit);
+      bool inserted = insertColumn(_cols, V.col(k), singularityLimit);
       if (!inserted) {
         delIndices.push_back(k);
       }
@@ -176,59 +192,56 @@ void QRFactorization::deleteColumn(int k)
   for (int l = k; l < _cols - 1; l++) {
     QRFactorization::givensRot grot;
     computeReflector(grot, _R(l, l + 1), _R(l + 1, l + 1));
-    Eigen::VectorXd Rr1 = _R.row(l);
-    Eigen::VectorXd Rr2 = _R.row(l + 1);
-    applyReflector(grot, l + 2, _cols, Rr1, Rr2);
-    _R.row(l)           = Rr1;
-    _R.row(l + 1)       = Rr2;
-    Eigen::VectorXd Qc1 = _Q.col(l);
-    Eigen::VectorXd Qc2 = _Q.col(l + 1);
-    applyReflector(grot, 0, _rows, Qc1, Qc2);
-    _Q.col(l)     = Qc1;
-    _Q.col(l + 1) = Qc2;
+    applyReflector(grot, l + 2, _cols, _R.row(l), _R.row(l + 1));
+    applyReflector(grot, 0, _rows, _Q.col(l), _Q.col(l + 1));
   }
-  // copy values and resize R and Q
+  // copy values, the last column of Q and R remains as spare storage
   for (int j = k; j < _cols - 1; j++) {
     for (int i = 0; i <= j; i++) {
       _R(i, j) = _R(i, j + 1);
     }
   }
-  _R.conservativeResize(_cols - 1, _cols - 1);
-  //_Q.conservativeResize(Eigen::NoChange_t, _cols-1);
-  _Q.conservativeResize(_rows, _cols - 1);
   _cols--;
 
-  assertion(_Q.cols() == _cols, _Q.cols(), _cols);
+  assertion(_Q.cols() >= _cols, _Q.cols(), _cols);
   assertion(_Q.rows() == _rows, _Q.rows(), _rows);
-  assertion(_R.cols() == _cols, _R.cols(), _cols);
+  assertion(_R.cols() >= _cols, _R.cols(), _cols);
   //assertion(_R.rows() == _cols, _Q.rows(), _cols);
 }
 
 // ATTENTION: This method works on the memory of vector v, thus changes the vector v.
-bool QRFactorization::insertColumn(int k, const Eigen::VectorXd &vec, double singularityLimit)
+bool QRFactorization::insertColumn(int k, const Eigen::Ref<const Eigen::VectorXd> &vec, double singularityLimit)
 {
   TRACE(k);
 
-  Eigen::VectorXd v(vec);
-
   if (_cols == 0)
-    _rows = v.size();
+    _rows = vec.size();
 
   bool applyFilter = (singularityLimit > 0.0);
 
   assertion(k >= 0, k);
   assertion(k <= _cols, k, _cols);
-  assertion(v.size() == _rows, v.size(), _rows);
+  assertion(vec.size() == _rows, vec.size(), _rows);
 
   _cols++;
 
+  // the workspace vectors are only reallocated if the number of rows or the capacity changes
+  Eigen::VectorXd &v = _v;
+  v                  = vec;
+  if (_r.size() < _cols) {
+    _r.resize(2 * _cols);
+    _s.resize(2 * _cols);
+    _localProjection.resize(2 * _cols);
+  }
+
   // orthogonalize v to columns of Q
-  Eigen::VectorXd u(_cols);
-  double          rho_orth = 0., rho0 = 0.;
+  Eigen::VectorXd &u        = _r;
+  double           rho_orth = 0., rho0 = 0.;
   if (applyFilter)
     rho0 = utils::MasterSlave::l2norm(v);
 
-  int err = orthogonalize(v, u, rho_orth, _cols - 1);
+  int err = (_orthogonalization == CGS2) ? orthogonalizeCGS2(v, u, rho_orth, _cols - 1)
+                                          : orthogonalize(v, u, rho_orth, _cols - 1);
 
   // on of the following is true
   // - either ||v_orth|| / ||v|| <= 0.7 was true and the re-orthogonalization process failed 4 times
@@ -253,10 +266,10 @@ bool QRFactorization::insertColumn(int k, const Eigen::VectorXd &vec, double sin
     return false;
   }
 
-  // resize R(1:m, 1:m) -> R(1:m+1, 1:m+1)
-  _R.conservativeResize(_cols, _cols);
-  _R.col(_cols - 1) = Eigen::VectorXd::Zero(_cols);
-  _R.row(_cols - 1) = Eigen::VectorXd::Zero(_cols);
+  // resize R(1:m, 1:m) -> R(1:m+1, 1:m+1) and Q(1:n, 1:m) -> Q(1:n, 1:m+1)
+  reserveColumns();
+  _R.col(_cols - 1).head(_cols).setZero();
+  _R.row(_cols - 1).head(_cols).setZero();
 
   for (int j = _cols - 2; j >= k; j--) {
     for (int i = 0; i <= j; i++) {
@@ -268,30 +281,20 @@ bool QRFactorization::insertColumn(int k, const Eigen::VectorXd &vec, double sin
     _R(j, j) = 0.;
   }
 
-  assertion(_R.cols() == _cols, _R.cols(), _cols);
+  assertion(_R.cols() >= _cols, _R.cols(), _cols);
   //assertion(_R.rows() == _cols, _R.rows(), _cols);
 
-  // resize Q(1:n, 1:m) -> Q(1:n, 1:m+1)
-  _Q.conservativeResize(_rows, _cols);
   _Q.col(_cols - 1) = v;
 
-  assertion(_Q.cols() == _cols, _Q.cols(), _cols);
+  assertion(_Q.cols() >= _cols, _Q.cols(), _cols);
   assertion(_Q.rows() == _rows, _Q.rows(), _rows);
 
   // maintain decomposition and orthogonalization by application of givens rotations
   for (int l = _cols - 2; l >= k; l--) {
     QRFactorization::givensRot grot;
     computeReflector(grot, u(l), u(l + 1));
-    Eigen::VectorXd Rr1 = _R.row(l);
-    Eigen::VectorXd Rr2 = _R.row(l + 1);
-    applyReflector(grot, l + 1, _cols, Rr1, Rr2);
-    _R.row(l)           = Rr1;
-    _R.row(l + 1)       = Rr2;
-    Eigen::VectorXd Qc1 = _Q.col(l);
-    Eigen::VectorXd Qc2 = _Q.col(l + 1);
-    applyReflector(grot, 0, _rows, Qc1, Qc2);
-    _Q.col(l)     = Qc1;
-    _Q.col(l + 1) = Qc2;
+    applyReflector(grot, l + 1, _cols, _R.row(l), _R.row(l + 1));
+    applyReflector(grot, 0, _rows, _Q.col(l), _Q.col(l + 1));
   }
   for (int i = 0; i <= k; i++) {
     _R(i, k) = u(i);
@@ -325,12 +328,13 @@ int QRFactorization::orthogonalize(
     assertion(_globalRows != _rows, _globalRows, _rows, utils::MasterSlave::_rank);
   }
 
-  bool            null        = false;
-  bool            termination = false;
-  double          rho0 = 0., rho1 = 0.;
-  Eigen::VectorXd u = Eigen::VectorXd::Zero(_rows);
-  Eigen::VectorXd s = Eigen::VectorXd::Zero(colNum);
-  r                 = Eigen::VectorXd::Zero(_cols);
+  bool             null        = false;
+  bool             termination = false;
+  double           rho0 = 0., rho1 = 0.;
+  Eigen::VectorXd &u = _u;
+  u.resize(_rows);
+  auto s = _s.head(colNum);
+  r.head(_cols).setZero();
 
   rho   = utils::MasterSlave::l2norm(v); // distributed l2norm
   rho0  = rho;
@@ -338,14 +342,11 @@ int QRFactorization::orthogonalize(
   while (!termination) {
 
     // take a gram-schmidt iteration
-    u = Eigen::VectorXd::Zero(_rows);
+    u.setZero();
     for (int j = 0; j < colNum; j++) {
 
-      // dot-product <_Q(:,j), v >
-      Eigen::VectorXd Qc = _Q.col(j);
-
       // dot product <_Q(:,j), v> =: r_ij
-      double r_ij = utils::MasterSlave::dot(Qc, v);
+      double r_ij = utils::MasterSlave::dot(_Q.col(j), v);
       // save r_ij in s(j) = column of R
       s(j) = r_ij;
       // u is the sum of projections r_ij * _Q(:,j) =  _Q(:,j) * <_Q(:,j), v>
@@ -417,6 +418,114 @@ int QRFactorization::orthogonalize(
   return k;
 }
 
+/**
+ * @short assuming Q(1:n,1:m) has nearly orthonormal columns, this procedure
+ *   orthogonalizes v(1:n) to the columns of Q using classical Gram-Schmidt with
+ *   re-orthogonalization (CGS2), and normalizes the result.
+ *   r(1:n) is the array of Fourier coefficients, and rho is the distance
+ *   from v to range of Q.
+ *
+ *   Each sweep costs one global reduction of colNum+1 values, instead of one
+ *   reduction per column of Q and two norms as in orthogonalize(). The norm of the
+ *   orthogonalized v is obtained from the reduction of the following sweep.
+ *
+ *   @return Returns the number of gram-schmidt sweeps needed to orthogonalize the
+ *   new vector to the existing system. If more then 4 sweeps were needed, -1 is
+ *   returned and the new column should not be inserted into the system.
+ */
+int QRFactorization::orthogonalizeCGS2(
+    Eigen::VectorXd &v,
+    Eigen::VectorXd &r,
+    double &         rho,
+    int              colNum)
+{
+  TRACE();
+
+  if (not utils::MasterSlave::_masterMode && not utils::MasterSlave::_slaveMode) {
+    assertion(_globalRows == _rows, _globalRows, _rows);
+  } else {
+    assertion(_globalRows != _rows, _globalRows, _rows, utils::MasterSlave::_rank);
+  }
+
+  bool             null = false;
+  double           rho0 = 0., rho1 = 0.;
+  Eigen::VectorXd &projection = _s;
+  r.head(_cols).setZero();
+
+  projectCGS2(v, colNum, projection);
+  rho   = std::sqrt(projection(colNum));
+  rho0  = rho;
+  int k = 0;
+  while (true) {
+    // take a gram-schmidt sweep with the coefficients s = Q^T v of the last reduction
+    auto   s                 = projection.head(colNum);
+    double norm_coefficients = s.norm();
+    if (colNum > 0) {
+      r.head(colNum) += s;
+      v.noalias() -= _Q.leftCols(colNum) * s;
+    }
+    k++;
+
+    // the reduction for the next sweep yields rho1 = norm of orthogonalized new column v_tilde
+    projectCGS2(v, colNum, projection);
+    rho1 = std::sqrt(projection(colNum));
+
+    // treat the special case m=n
+    // Attention (Master-Slave): Here, we need to compare the global _rows with colNum and NOT the local
+    // rows on the processor.
+    if (_globalRows == colNum) {
+      WARN("The least-squares system matrix is quadratic, i.e., the new column cannot be orthogonalized (and thus inserted) to the LS-system.\nOld columns need to be removed.");
+      v   = Eigen::VectorXd::Zero(_rows);
+      rho = 0.;
+      return k;
+    }
+
+    // take correct action if v_orth is null
+    if (rho1 <= std::numeric_limits<double>::min()) {
+      DEBUG("The norm of v_orthogonal is almost zero, i.e., failed to orthogonalize column v; discard.");
+      null = true;
+      rho1 = 1;
+      break;
+    }
+
+    // CGS2 always takes a second sweep, further ones if ||v_orth|| / ||v|| <= 1/theta
+    if (k >= 2 && rho1 * _theta > rho0 + _omega * norm_coefficients) {
+      break;
+    }
+    if (k >= 4) {
+      WARN("Matrix Q is not sufficiently orthogonal. Failed to rorthogonalize new column after 4 iterations. New column will be discarded. The least-squares system is very bad conditioned and the quasi-Newton will most probably fail to converge.");
+      return -1;
+    }
+    rho0 = rho1;
+  }
+
+  // normalize v
+  v /= rho1;
+  rho       = null ? 0 : rho1;
+  r(colNum) = rho;
+  return k;
+}
+
+void QRFactorization::projectCGS2(
+    const Eigen::VectorXd &v,
+    int                    colNum,
+    Eigen::VectorXd &      projection)
+{
+  // Q may still be empty, if the first column is inserted
+  Eigen::VectorXd &local = _localProjection;
+  if (colNum > 0) {
+    local.head(colNum).noalias() = _Q.leftCols(colNum).transpose() * v;
+  }
+  local(colNum) = v.squaredNorm();
+
+  if (not utils::MasterSlave::_masterMode && not utils::MasterSlave::_slaveMode) {
+    projection.head(colNum + 1) = local.head(colNum + 1);
+  } else {
+    // local is modified by the reduction, do not use afterwards
+    utils::MasterSlave::allreduceSum(local.data(), projection.data(), colNum + 1);
+  }
+}
+
 /**
  * @short assuming Q(1:n,1:m) has nearly orthonormal columns, this procedure
  *   orthogonlizes v(1:n) to the columns of Q, and normalizes the result.
@@ -644,13 +753,19 @@ void QRFactorization::computeReflector(
  *  @short this procedure replaces the two column matrix [p(k:l-1), q(k:l-1)] by [p(k:l), q(k:l)]*G, 
  *  where G is the Givens matrix grot, determined by sigma and gamma. 
  */
+template <typename Derived1, typename Derived2>
 void QRFactorization::applyReflector(
-    const QRFactorization::givensRot &grot,
-    int                               k,
-    int                               l,
-    Eigen::VectorXd &                 p,
-    Eigen::VectorXd &                 q)
+    const QRFactorization::givensRot &  grot,
+    int                                 k,
+    int                                 l,
+    const Eigen::MatrixBase<Derived1> &pView,
+    const Eigen::MatrixBase<Derived2> &qView)
 {
+  // p, q are rows or columns of R and Q, i.e., temporary block expressions that are
+  // written to in place, see "Writing Functions Taking Eigen Types as Parameters"
+  Eigen::MatrixBase<Derived1> &p = const_cast<Eigen::MatrixBase<Derived1> &>(pView);
+  Eigen::MatrixBase<Derived2> &q = const_cast<Eigen::MatrixBase<Derived2> &>(qView);
+
   double nu = grot.sigma / (1. + grot.gamma);
   for (int j = k; j < l; j++) {
     double u = p(j);
@@ -666,14 +781,30 @@ void QRFactorization::setGlobalRows(int gr)
   _globalRows = gr;
 }
 
-Eigen::MatrixXd &QRFactorization::matrixQ()
+void QRFactorization::reserveColumns()
+{
+  // the storage of an empty factorization may still have the rows of a previous one
+  if (_Q.rows() != _rows) {
+    assertion(_cols == 1, _cols);
+    _Q.resize(_rows, std::max<int>(_Q.cols(), _cols));
+  }
+  if (_Q.cols() < _cols) {
+    _Q.conservativeResize(Eigen::NoChange, 2 * _cols);
+  }
+  if (_R.cols() < _cols) {
+    _R.conservativeResize(2 * _cols, 2 * _cols);
+  }
+}
+
+Eigen::Block<Eigen::MatrixXd> QRFactorization::matrixQ()
 {
-  return _Q;
+  // an empty factorization may still hold the storage of a previous one
+  return _Q.block(0, 0, (_cols > 0) ? _rows : 0, _cols);
 }
 
-Eigen::MatrixXd &QRFactorization::matrixR()
+Eigen::Block<Eigen::MatrixXd> QRFactorization::matrixR()
 {
-  return _R;
+  return _R.topLeftCorner(_cols, _cols);
 }
 
 int QRFactorization::cols()
@@ -688,8 +819,7 @@ int QRFactorization::rows()
 
 void QRFactorization::reset()
 {
-  _Q.resize(0, 0);
-  _R.resize(0, 0);
+  // the storage of Q and R is kept for the next factorization
   _cols       = 0;
   _rows       = 0;
   _globalRows = 0;
@@ -719,15 +849,13 @@ void QRFactorization::reset(
 }
 
 void QRFactorization::reset(
-    Eigen::MatrixXd const &A,
-    int                    globalRows,
-    double                 omega,
-    double                 theta,
-    double                 sigma)
+    Eigen::Ref<const Eigen::MatrixXd> A,
+    int                               globalRows,
+    double                            omega,
+    double                            theta,
+    double                            sigma)
 {
   TRACE();
-  _Q.resize(0, 0);
-  _R.resize(0, 0);
   _cols       = 0;
   _rows       = A.rows();
   _omega      = omega;
@@ -738,17 +866,16 @@ void QRFactorization::reset(
   int m   = A.cols();
   int col = 0, k = 0;
   for (; col < m; k++, col++) {
-    Eigen::VectorXd v        = A.col(col);
-    bool            inserted = insertColumn(k, v);
+    bool inserted = insertColumn(k, A.col(col));
     if (not inserted) {
       k--;
       DEBUG("column " << col << " has not been inserted in the QR-factorization, failed to orthogonalize.");
     }
   }
-  assertion(_R.rows() == _cols, _R.rows(), _cols);
-  assertion(_R.cols() == _cols, _R.cols(), _cols);
-  assertion(_Q.cols() == _cols, _Q.cols(), _cols);
-  assertion(_Q.rows() == _rows, _Q.rows(), _rows);
+  assertion(_R.rows() >= _cols, _R.rows(), _cols);
+  assertion(_R.cols() >= _cols, _R.cols(), _cols);
+  assertion(_Q.cols() >= _cols, _Q.cols(), _cols);
+  assertion(_cols == 0 || _Q.rows() == _rows, _Q.rows(), _rows);
   assertion(_cols == m, _cols, m);
 }
 
@@ -778,6 +905,11 @@ void QRFactorization::setfstream(std::fstream *stream)
   _fstream_set = true;
 }
 
+void QRFactorization::setOrthogonalization(int orthogonalization)
+{
+  _orthogonalization = orthogonalization;
+}
+
 void QRFactorization::setFilter(int filter)
 {
   _filter = filter;
@@ -17,14 +17,24 @@ namespace impl
 /**
  * @brief Class that provides functionality for a dynamic QR-decomposition, that can be updated 
  * in O(mn) flops if a column is inserted or deleted. 
- * The new colmn is orthogonalized to the existing columns in Q using a modified GramSchmidt algorithm.
+ * The new colmn is orthogonalized to the existing columns in Q using a modified GramSchmidt algorithm
+ * or, if set, a classical GramSchmidt algorithm with re-orthogonalization (CGS2).
  * The zero-elements are generated using suitable givens-roatations.
  * The Interface provides fnctions such as insertColumn, deleteColumn at arbitrary position an push or pull 
  * column at front or back, resp. 
+ *
+ * Q and R are stored with spare columns, such that insertions and deletions do not reallocate
+ * their storage. Together with the workspace vectors of the orthogonalization, updates of the
+ * factorization do not allocate memory once the number of columns has settled.
  */
 class QRFactorization
 {
 public:
+  /// Gram-Schmidt with one global reduction per existing column.
+  static const int MGS = 0;
+  /// Classical Gram-Schmidt with re-orthogonalization, one global reduction per sweep.
+  static const int CGS2 = 1;
+
   /**
    * @brief Constructor.
    * @param theta - singularity limit for reothogonalization ||v_orth|| / ||v|| <= 1/theta
@@ -86,17 +96,17 @@ public:
     * @brief resets the QR factorization to be the factorization of A = QR
     */
   void reset(
-      Eigen::MatrixXd const &A,
-      int                    globalRows,
-      double                 omega = 0,
-      double                 theta = 1. / 0.7,
-      double                 sigma = std::numeric_limits<double>::min());
+      Eigen::Ref<const Eigen::MatrixXd> A,
+      int                               globalRows,
+      double                            omega = 0,
+      double                            theta = 1. / 0.7,
+      double                            sigma = std::numeric_limits<double>::min());
 
   /**
     * @brief inserts a new column at arbitrary position and updates the QR factorization
     * This function works on the memory of v, thus changes the Vector v.
     */
-  bool insertColumn(int k, const Eigen::VectorXd &v, double singularityLimit = 0);
+  bool insertColumn(int k, const Eigen::Ref<const Eigen::VectorXd> &v, double singularityLimit = 0);
 
   /**
    * @brief updates the factorization A=Q[1:n,1:m]R[1:m,1:n] when the kth column of A is deleted. 
@@ -135,17 +145,17 @@ public:
     * to the defined filter technique. This is done to ensure good conditioning
     * @param [out] delIndices - a vector of indices of deleted columns from the LS-system
     */
-  void applyFilter(double singularityLimit, std::vector<int> &delIndices, Eigen::MatrixXd &V);
+  void applyFilter(double singularityLimit, std::vector<int> &delIndices, Eigen::Ref<const Eigen::MatrixXd> V);
 
   /**
-    * @brief returns a matrix representation of the orthogonal matrix Q
+    * @brief returns a matrix representation of the orthogonal matrix Q, i.e., a view of the first cols() stored columns
     */
-  Eigen::MatrixXd &matrixQ();
+  Eigen::Block<Eigen::MatrixXd> matrixQ();
 
   /**
-    * @brief returns a matrix representation of the upper triangular matrix R
+    * @brief returns a matrix representation of the upper triangular matrix R, i.e., a view of the stored R
     */
-  Eigen::MatrixXd &matrixR();
+  Eigen::Block<Eigen::MatrixXd> matrixR();
 
   // @brief returns the number of columns in the QR-decomposition
   int cols();
@@ -161,6 +171,9 @@ public:
   // @brief sets the filtering technique to maintain good conditioning of the least squares system
   void setFilter(int filter);
 
+  // @brief sets the Gram-Schmidt variant used to insert columns, i.e., MGS or CGS2
+  void setOrthogonalization(int orthogonalization);
+
 private:
   struct givensRot {
     int    i, j;
@@ -194,6 +207,21 @@ private:
    */
   int orthogonalize(Eigen::VectorXd &v, Eigen::VectorXd &r, double &rho, int colNum);
 
+  /**
+   * @short assuming Q(1:n,1:m) has nearly orthonormal columns, this procedure
+   *   orthogonalizes v(1:n) to the columns of Q using classical Gram-Schmidt with
+   *   re-orthogonalization (CGS2), and normalizes the result.
+   *
+   *   Difference to the method orthogonalize():
+   *   all Fourier coefficients Q^T v of a sweep are computed by one local matrix-vector
+   *   product and a single global reduction, which also yields the norm of v. At least two
+   *   sweeps are taken, at most 4 if ||v_orth|| / ||v|| <= 1/theta.
+   */
+  int orthogonalizeCGS2(Eigen::VectorXd &v, Eigen::VectorXd &r, double &rho, int colNum);
+
+  /// Computes [Q(:,1:colNum)^T v; ||v||^2] over all ranks.
+  void projectCGS2(const Eigen::VectorXd &v, int colNum, Eigen::VectorXd &projection);
+
   /**
   * @short computes parameters for givens matrix G for which  (x,y)G = (z,0). replaces (x,y) by (z,0)
   */
@@ -203,18 +231,36 @@ private:
   *  @short this procedure replaces the two column matrix [p(k:l-1), q(k:l-1)] by [p(k:l), q(k:l)]*G, 
   *  where G is the Givens matrix grot, determined by sigma and gamma. 
   */
-  void applyReflector(const givensRot &grot, int k, int l, Eigen::VectorXd &p, Eigen::VectorXd &q);
+  template <typename Derived1, typename Derived2>
+  void applyReflector(const givensRot &grot, int k, int l, const Eigen::MatrixBase<Derived1> &p, const Eigen::MatrixBase<Derived2> &q);
+
+  /// Grows the storage of Q and R, if it cannot hold _cols columns.
+  void reserveColumns();
 
   // @brief Logging device.
   static logging::Logger _log;
 
+  /// Storage of Q, the factor Q is _Q.leftCols(_cols)
   Eigen::MatrixXd _Q;
+  /// Storage of R, the factor R is _R.topLeftCorner(_cols, _cols)
   Eigen::MatrixXd _R;
 
+  /// Workspace: the column that is inserted, size _rows
+  Eigen::VectorXd _v;
+  /// Workspace: sum of the projections onto Q in orthogonalize(), size _rows
+  Eigen::VectorXd _u;
+  /// Workspace: the new column of R, at least of size _cols
+  Eigen::VectorXd _r;
+  /// Workspace: the Fourier coefficients of one Gram-Schmidt sweep, at least of size _cols
+  Eigen::VectorXd _s;
+  /// Workspace: the local part of the reduction in projectCGS2(), at least of size _cols
+  Eigen::VectorXd _localProjection;
+
   int _rows;
   int _cols;
 
   int    _filter;
+  int    _orthogonalization;
   double _omega;
   double _theta;
   double _sigma;
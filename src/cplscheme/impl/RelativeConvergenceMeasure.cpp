@@ -17,6 +17,8 @@ RelativeConvergenceMeasure::RelativeConvergenceMeasure(
       _convergenceLimitPercent(convergenceLimitPercent),
       _normDiff(0.0),
       _norm(0.0),
+      _normDiffHandle(-1),
+      _normHandle(-1),
       _isConvergence(false)
 {
   CHECK(math::greater(_convergenceLimitPercent, 0.0) && math::greaterEquals(1.0, _convergenceLimitPercent),
@@ -57,21 +57,20 @@ public:
     _isConvergence = false;
   }
 
-  virtual void measure(
+  virtual void addNorms(
       const Eigen::VectorXd &oldValues,
       const Eigen::VectorXd &newValues,
-      const Eigen::VectorXd &designSpecification)
+      const Eigen::VectorXd &designSpecification,
+      NormBatch &            batch)
   {
-    /*
-     std::cout<<"\n-------"<<std::endl;
-     std::cout<<"   old val: \n"<<oldValues<<std::endl;
-     std::cout<<"   new val: \n"<<newValues<<"\n"<<std::endl;
-     std::cout<<"   design spec: \n"<<designSpecification<<"\n"<<std::endl;
-     std::cout<<"-------\n"<<std::endl;
-*/
-
-    _normDiff      = utils::MasterSlave::l2norm((newValues - oldValues) - designSpecification);
-    _norm          = utils::MasterSlave::l2norm(newValues + designSpecification);
+    _normDiffHandle = batch.add((newValues - oldValues) - designSpecification);
+    _normHandle     = batch.add(newValues + designSpecification);
+  }
+
+  virtual void evaluate(const NormBatch &batch)
+  {
+    _normDiff      = batch.norm(_normDiffHandle);
+    _norm          = batch.norm(_normHandle);
     _isConvergence = _normDiff <= _norm * _convergenceLimitPercent;
     //      INFO("Relative convergence measure: "
     //                    << "two-norm differences = " << normDiff
@@ -119,6 +118,10 @@ private:
 
   double _norm;
 
+  /// Handles of the norms in the current NormBatch.
+  int _normDiffHandle;
+  int _normHandle;
+
   bool _isConvergence;
 };
 }
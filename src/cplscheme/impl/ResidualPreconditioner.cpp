@@ -1,5 +1,5 @@
 #include "ResidualPreconditioner.hpp"
-#include "utils/MasterSlave.hpp"
+#include "NormBatch.hpp"
 
 namespace precice
 {
@@ -21,16 +21,18 @@ ResidualPreconditioner::ResidualPreconditioner(
 void ResidualPreconditioner::_update_(bool timestepComplete, const Eigen::VectorXd &oldValues, const Eigen::VectorXd &res)
 {
   if (not timestepComplete) {
-    std::vector<double> norms(_subVectorSizes.size(), 0.0);
-
-    int offset = 0;
+    // the norms of all sub-vectors share one global reduction
+    NormBatch batch;
+    int       offset = 0;
     for (size_t k = 0; k < _subVectorSizes.size(); k++) {
-      Eigen::VectorXd part = Eigen::VectorXd::Zero(_subVectorSizes[k]);
-      for (size_t i = 0; i < _subVectorSizes[k]; i++) {
-        part(i) = res(i + offset);
-      }
-      norms[k] = utils::MasterSlave::l2norm(part);
+      batch.add(res.segment(offset, _subVectorSizes[k]));
       offset += _subVectorSizes[k];
+    }
+    batch.reduce();
+
+    std::vector<double> norms(_subVectorSizes.size(), 0.0);
+    for (size_t k = 0; k < _subVectorSizes.size(); k++) {
+      norms[k] = batch.norm(k);
       assertion(norms[k] > 0.0);
     }
 
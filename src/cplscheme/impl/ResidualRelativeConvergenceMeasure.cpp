@@ -19,6 +19,7 @@ ResidualRelativeConvergenceMeasure::ResidualRelativeConvergenceMeasure(
       _isFirstIteration(true),
       _normFirstResidual(std::numeric_limits<double>::max()),
       _normDiff(0.0),
+      _normDiffHandle(-1),
       _isConvergence(false)
 {
   CHECK(math::greater(_convergenceLimitPercent, 0.0) && math::greaterEquals(1.0, _convergenceLimitPercent),
@@ -45,12 +45,18 @@ public:
     _normFirstResidual = std::numeric_limits<double>::max();
   }
 
-  virtual void measure(
+  virtual void addNorms(
       const Eigen::VectorXd &oldValues,
       const Eigen::VectorXd &newValues,
-      const Eigen::VectorXd &designSpecification)
+      const Eigen::VectorXd &designSpecification,
+      NormBatch &            batch)
   {
-    _normDiff = utils::MasterSlave::l2norm((newValues - oldValues) - designSpecification);
+    _normDiffHandle = batch.add((newValues - oldValues) - designSpecification);
+  }
+
+  virtual void evaluate(const NormBatch &batch)
+  {
+    _normDiff = batch.norm(_normDiffHandle);
     if (_isFirstIteration) {
       _normFirstResidual = _normDiff;
       _isFirstIteration  = false;
@@ -94,6 +100,9 @@ private:
 
   double _normDiff;
 
+  /// Handle of the norm of the differences in the current NormBatch.
+  int _normDiffHandle;
+
   bool _isConvergence;
 };
 }
@@ -1,5 +1,5 @@
 #include "ValuePreconditioner.hpp"
-#include "utils/MasterSlave.hpp"
+#include "NormBatch.hpp"
 
 namespace precice
 {
@@ -23,16 +23,18 @@ void ValuePreconditioner::_update_(bool timestepComplete, const Eigen::VectorXd
 {
   if (timestepComplete || _firstTimestep) {
 
-    std::vector<double> norms(_subVectorSizes.size(), 0.0);
-
-    int offset = 0;
+    // the norms of all sub-vectors share one global reduction
+    NormBatch batch;
+    int       offset = 0;
     for (size_t k = 0; k < _subVectorSizes.size(); k++) {
-      Eigen::VectorXd part = Eigen::VectorXd::Zero(_subVectorSizes[k]);
-      for (size_t i = 0; i < _subVectorSizes[k]; i++) {
-        part(i) = oldValues(i + offset);
-      }
-      norms[k] = utils::MasterSlave::l2norm(part);
+      batch.add(oldValues.segment(offset, _subVectorSizes[k]));
       offset += _subVectorSizes[k];
+    }
+    batch.reduce();
+
+    std::vector<double> norms(_subVectorSizes.size(), 0.0);
+    for (size_t k = 0; k < _subVectorSizes.size(); k++) {
+      norms[k] = batch.norm(k);
       assertion(norms[k] > 0.0);
     }
 
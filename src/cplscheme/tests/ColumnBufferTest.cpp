@@ -0,0 +1,138 @@
+#include <Eigen/Core>
+#include "cplscheme/impl/ColumnBuffer.hpp"
+#include "cplscheme/impl/MixedPrecisionColumnBuffer.hpp"
+#include "testing/Testing.hpp"
+#include "utils/EigenHelperFunctions.hpp"
+
+BOOST_AUTO_TEST_SUITE(CplSchemeTests)
+
+using namespace precice;
+using namespace cplscheme;
+
+BOOST_AUTO_TEST_SUITE(ColumnBufferTests)
+
+/// Checks that the buffer equals the reference and that its view is stored contiguously.
+void testEqualsReference(impl::ColumnBuffer &buffer, Eigen::MatrixXd &reference)
+{
+  BOOST_TEST(buffer.rows() == reference.rows());
+  BOOST_TEST(buffer.cols() == reference.cols());
+  BOOST_TEST(buffer.matrix().outerStride() == buffer.rows());
+  BOOST_TEST(testing::equals(buffer.matrix(), reference));
+}
+
+BOOST_AUTO_TEST_CASE(testQNUpdatePattern)
+{
+  int                rows = 5, maxCols = 4;
+  impl::ColumnBuffer buffer;
+  buffer.reserve(rows, maxCols);
+  BOOST_TEST(buffer.capacity() == maxCols);
+
+  // emulate the V, W updates of the quasi-Newton post-processing, including the removal of
+  // filtered columns, for longer than the window takes to run through the storage
+  Eigen::MatrixXd reference(rows, 0);
+  for (int it = 0; it < 40; it++) {
+    Eigen::VectorXd column = Eigen::VectorXd::Constant(rows, it);
+    column(0)              = -it;
+    if (buffer.cols() == maxCols) {
+      buffer.popBack();
+      buffer.pushFront(column);
+      utils::shiftSetFirst(reference, column);
+    } else {
+      buffer.pushFront(column);
+      utils::appendFront(reference, column);
+    }
+    if (it % 7 == 6) {
+      buffer.removeColumn(1);
+      utils::removeColumnFromMatrix(reference, 1);
+    }
+    if (it % 11 == 10) {
+      buffer.removeColumn(buffer.cols() - 2);
+      utils::removeColumnFromMatrix(reference, reference.cols() - 2);
+    }
+    testEqualsReference(buffer, reference);
+  }
+  // the reserved storage suffices, no reallocation took place
+  BOOST_TEST(buffer.capacity() == maxCols);
+
+  buffer.clear();
+  BOOST_TEST(buffer.cols() == 0);
+  BOOST_TEST(buffer.rows() == rows);
+}
+
+BOOST_AUTO_TEST_CASE(testGrowAndAssign)
+{
+  // without reserve(), the storage grows on demand
+  impl::ColumnBuffer buffer;
+  Eigen::MatrixXd    reference(3, 0);
+  for (int it = 0; it < 10; it++) {
+    Eigen::VectorXd column = Eigen::VectorXd::Constant(3, it);
+    buffer.pushFront(column);
+    utils::appendFront(reference, column);
+    testEqualsReference(buffer, reference);
+  }
+
+  Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(3, 20);
+  buffer.assign(matrix);
+  testEqualsReference(buffer, matrix);
+
+  // views write through to the buffer
+  buffer.matrix() *= 2.0;
+  buffer.col(0).setZero();
+  matrix *= 2.0;
+  matrix.col(0).setZero();
+  testEqualsReference(buffer, matrix);
+}
+
+BOOST_AUTO_TEST_CASE(testMixedPrecision)
+{
+  int                              rows = 50;
+  impl::MixedPrecisionColumnBuffer doubleBuffer, singleBuffer;
+  singleBuffer.setSinglePrecision(true);
+  BOOST_TEST(singleBuffer.isSinglePrecision());
+  doubleBuffer.reserve(rows, 4);
+  singleBuffer.reserve(rows, 4);
+
+  Eigen::MatrixXd reference(rows, 0);
+  for (int it = 0; it < 6; it++) {
+    Eigen::VectorXd column = Eigen::VectorXd::Random(rows);
+    if (doubleBuffer.cols() == 4) {
+      doubleBuffer.popBack();
+      singleBuffer.popBack();
+      utils::shiftSetFirst(reference, column);
+    } else {
+      utils::appendFront(reference, column);
+    }
+    doubleBuffer.pushFront(column);
+    singleBuffer.pushFront(column);
+  }
+  doubleBuffer.removeColumn(1);
+  singleBuffer.removeColumn(1);
+  utils::removeColumnFromMatrix(reference, 1);
+
+  BOOST_TEST(testing::equals(doubleBuffer.toMatrix(), reference));
+  BOOST_TEST(singleBuffer.cols() == reference.cols());
+  BOOST_TEST(singleBuffer.rows() == reference.rows());
+  // single precision only rounds the stored entries
+  BOOST_TEST(testing::equals(singleBuffer.toMatrix(), reference, 1e-6));
+  BOOST_TEST(testing::equals(singleBuffer.col(2), reference.col(2), 1e-6));
+
+  Eigen::VectorXd coefficients = Eigen::VectorXd::Random(reference.cols());
+  Eigen::VectorXd result(rows);
+  doubleBuffer.multiply(coefficients, result);
+  BOOST_TEST(testing::equals(result, reference * coefficients));
+  singleBuffer.multiply(coefficients, result);
+  BOOST_TEST(testing::equals(result, reference * coefficients, 1e-5));
+
+  Eigen::MatrixXd sum = reference;
+  singleBuffer.addTo(sum);
+  BOOST_TEST(testing::equals(sum, 2.0 * reference, 1e-6));
+
+  // copies keep the stored entries, hence, no further rounding
+  impl::MixedPrecisionColumnBuffer backup;
+  backup.assign(singleBuffer);
+  BOOST_TEST(backup.isSinglePrecision());
+  BOOST_TEST(testing::equals(backup.toMatrix(), singleBuffer.toMatrix()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
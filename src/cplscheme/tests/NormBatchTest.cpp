@@ -0,0 +1,75 @@
+#include <Eigen/Core>
+#include "cplscheme/impl/AbsoluteConvergenceMeasure.hpp"
+#include "cplscheme/impl/NormBatch.hpp"
+#include "cplscheme/impl/RelativeConvergenceMeasure.hpp"
+#include "testing/Fixtures.hpp"
+#include "testing/Testing.hpp"
+#include "utils/MasterSlave.hpp"
+
+BOOST_AUTO_TEST_SUITE(CplSchemeTests)
+
+using namespace precice;
+using namespace cplscheme;
+
+BOOST_AUTO_TEST_SUITE(NormBatchTests)
+
+BOOST_AUTO_TEST_CASE(testSharedMeasurement)
+{
+  Eigen::Vector3d oldValues(2, 2, 2);
+  Eigen::Vector3d newValues(3, 3, 3);
+  Eigen::Vector3d designSpec(0, 0, 0);
+
+  impl::AbsoluteConvergenceMeasure absolute(1.0);
+  impl::RelativeConvergenceMeasure relative(0.5);
+
+  impl::NormBatch batch;
+  absolute.addNorms(oldValues, newValues, designSpec, batch);
+  relative.addNorms(oldValues, newValues, designSpec, batch);
+  BOOST_TEST(batch.size() == 3);
+  batch.reduce();
+  absolute.evaluate(batch);
+  relative.evaluate(batch);
+
+  // the batched evaluation equals separate measurements
+  impl::AbsoluteConvergenceMeasure absoluteRef(1.0);
+  impl::RelativeConvergenceMeasure relativeRef(0.5);
+  absoluteRef.measure(oldValues, newValues, designSpec);
+  relativeRef.measure(oldValues, newValues, designSpec);
+
+  BOOST_TEST(not absolute.isConvergence());
+  BOOST_TEST(relative.isConvergence());
+  BOOST_TEST(absolute.isConvergence() == absoluteRef.isConvergence());
+  BOOST_TEST(relative.isConvergence() == relativeRef.isConvergence());
+  BOOST_TEST(testing::equals(absolute.getNormResidual(), absoluteRef.getNormResidual()));
+  BOOST_TEST(testing::equals(relative.getNormResidual(), relativeRef.getNormResidual()));
+}
+
+#ifndef PRECICE_NO_MPI
+
+BOOST_AUTO_TEST_CASE(testDistributedNorms,
+                     * testing::OnSize(4) * boost::unit_test::fixture<testing::MasterComFixture>())
+{
+  // rank r holds r+1 entries of the value r+1 in the first and a single entry 1 in the second vector,
+  // rank 2 holds no entries at all
+  int             rank = utils::MasterSlave::_rank;
+  Eigen::VectorXd first, second;
+  if (rank != 2) {
+    first  = Eigen::VectorXd::Constant(rank + 1, rank + 1);
+    second = Eigen::VectorXd::Ones(1);
+  }
+
+  impl::NormBatch batch;
+  int             firstHandle  = batch.add(first);
+  int             secondHandle = batch.add(second);
+  batch.reduce();
+
+  // 1*1 + 2*4 + 4*16 = 73
+  BOOST_TEST(testing::equals(batch.norm(firstHandle), std::sqrt(73.0)));
+  BOOST_TEST(testing::equals(batch.norm(secondHandle), std::sqrt(3.0)));
+  BOOST_TEST(testing::equals(batch.norm(firstHandle), utils::MasterSlave::l2norm(first)));
+}
+
+#endif // PRECICE_NO_MPI
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
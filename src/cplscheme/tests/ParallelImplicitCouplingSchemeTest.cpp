@@ -22,6 +22,7 @@
 #include "m2n/M2N.hpp"
 #include "xml/XMLTag.hpp"
 #include <Eigen/Core>
+#include <cmath>
 #include <string>
 #include "utils/EigenHelperFunctions.hpp"
 
@@ -184,8 +185,202 @@ BOOST_AUTO_TEST_CASE(testMVQNPP)
   BOOST_TEST(testing::equals((*data.at(1)->values)(3), 8.28025852497733250157e-02));
 }
 
-BOOST_AUTO_TEST_CASE(testVIQNPP)
+/**
+ * Iterates the affine fixed-point problem x = M*x + b(t) for the given number of time steps with the given
+ * post-processing. A time step ends after maxIterations iterations or, for a positive convergenceLimit,
+ * once the relative residual drops below the limit. Returns the total number of evaluations of M*x + b and
+ * stores the post-processed iterates, if iterates is given.
+ */
+int iterateAffineProblem(
+    cplscheme::impl::PostProcessing &pp,
+    const Eigen::MatrixXd &          M,
+    int                              timesteps,
+    int                              maxIterations,
+    double                           convergenceLimit = 0.0,
+    std::vector<Eigen::VectorXd> *   iterates         = nullptr)
+{
+  int             n = M.rows() / 2;
+  mesh::PtrMesh   dummyMesh(new mesh::Mesh("dummyMesh", 3, false));
+  Eigen::VectorXd dvalues = Eigen::VectorXd::Zero(n);
+  Eigen::VectorXd fvalues = Eigen::VectorXd::Zero(n);
+  PtrCouplingData dpcd(new CouplingData(&dvalues, dummyMesh, false, 1));
+  PtrCouplingData fpcd(new CouplingData(&fvalues, dummyMesh, false, 1));
+  std::map<int, PtrCouplingData> data;
+  data.insert(std::make_pair(0, dpcd));
+  data.insert(std::make_pair(1, fpcd));
+  pp.initialize(data);
+
+  int             evaluations = 0;
+  Eigen::VectorXd x           = Eigen::VectorXd::Zero(2 * n);
+  for (int t = 0; t < timesteps; t++) {
+    Eigen::VectorXd b = Eigen::VectorXd::LinSpaced(2 * n, 1.0, 2.0 + t);
+    for (int k = 0; k < maxIterations; k++) {
+      Eigen::VectorXd y      = M * x + b;
+      dpcd->oldValues.col(0) = x.head(n);
+      fpcd->oldValues.col(0) = x.tail(n);
+      dvalues                = y.head(n);
+      fvalues                = y.tail(n);
+      evaluations++;
+      if (convergenceLimit > 0.0 && (y - x).norm() <= convergenceLimit * y.norm()) {
+        break;
+      }
+      pp.performPostProcessing(data);
+      x.head(n) = dvalues;
+      x.tail(n) = fvalues;
+      if (iterates != nullptr) {
+        iterates->push_back(x);
+      }
+    }
+    pp.iterationsConverged(data);
+    x.head(n) = dvalues;
+    x.tail(n) = fvalues;
+  }
+  return evaluations;
+}
+
+BOOST_AUTO_TEST_CASE(testMVQNLowRankPP)
+{
+  double           initialRelaxation        = 0.1;
+  int              maxIterationsUsed        = 50;
+  int              timestepsReused          = 0;
+  int              reusedTimestepsAtRestart = 0;
+  int              chunkSize                = 0;
+  int              filter                   = cplscheme::impl::PostProcessing::QR1FILTER;
+  double           singularityLimit         = 1e-10;
+  double           svdTruncationEps         = 0.0;
+  bool             enforceInitialRelaxation = false;
+  bool             alwaysBuildJacobian      = false;
+  std::vector<int> dataIDs{0, 1};
+
+  // without truncation, the low-rank representation yields the same iterates as the explicit Jacobian
+  cplscheme::impl::PtrPreconditioner  precDense(new cplscheme::impl::ConstantPreconditioner({1.0, 1.0}));
+  cplscheme::impl::MVQNPostProcessing dense(initialRelaxation, enforceInitialRelaxation, maxIterationsUsed,
+                                            timestepsReused, filter, singularityLimit, dataIDs, precDense, alwaysBuildJacobian,
+                                            cplscheme::impl::MVQNPostProcessing::NO_RESTART, chunkSize, reusedTimestepsAtRestart, svdTruncationEps);
+  cplscheme::impl::PtrPreconditioner  precLowRank(new cplscheme::impl::ConstantPreconditioner({1.0, 1.0}));
+  cplscheme::impl::MVQNPostProcessing lowRank(initialRelaxation, enforceInitialRelaxation, maxIterationsUsed,
+                                              timestepsReused, filter, singularityLimit, dataIDs, precLowRank, alwaysBuildJacobian,
+                                              cplscheme::impl::MVQNPostProcessing::LOW_RANK, chunkSize, reusedTimestepsAtRestart, svdTruncationEps);
+
+  int             n = 4;
+  Eigen::MatrixXd M(2 * n, 2 * n);
+  for (int i = 0; i < 2 * n; i++) {
+    for (int j = 0; j < 2 * n; j++) {
+      M(i, j) = 0.5 / static_cast<double>(i + j + 1) + ((i == j) ? 0.3 : 0.0);
+    }
+  }
+
+  std::vector<Eigen::VectorXd> denseIterates, lowRankIterates;
+  iterateAffineProblem(dense, M, 4, 3, 0.0, &denseIterates);
+  iterateAffineProblem(lowRank, M, 4, 3, 0.0, &lowRankIterates);
+  BOOST_TEST(denseIterates.size() == lowRankIterates.size());
+  for (size_t i = 0; i < denseIterates.size(); i++) {
+    BOOST_TEST(testing::equals(denseIterates[i], lowRankIterates[i], 1e-8));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testSinglePrecisionHistory)
+{
+  double           initialRelaxation        = 0.1;
+  int              maxIterationsUsed        = 15;
+  int              timestepsReused          = 2;
+  int              filter                   = cplscheme::impl::PostProcessing::QR1FILTER;
+  double           singularityLimit         = 1e-10;
+  bool             enforceInitialRelaxation = false;
+  std::vector<int> dataIDs{0, 1};
+
+  int             n = 20;
+  Eigen::MatrixXd M(2 * n, 2 * n);
+  for (int i = 0; i < 2 * n; i++) {
+    for (int j = 0; j < 2 * n; j++) {
+      M(i, j) = 1.0 / static_cast<double>(i + j + 1) + ((i == j) ? 0.5 : 0.0) + 0.05 * std::sin(i * j + 1);
+    }
+  }
+
+  // Storing W in single precision must not increase the number of iterations of IQN-ILS.
+  for (double convergenceLimit : {1e-3, 1e-4, 1e-5, 1e-6, 1e-7}) {
+    int iterations[2];
+    for (int single = 0; single < 2; single++) {
+      cplscheme::impl::PtrPreconditioner   prec(new cplscheme::impl::ConstantPreconditioner({1.0, 1.0}));
+      cplscheme::impl::IQNILSPostProcessing pp(initialRelaxation, enforceInitialRelaxation, maxIterationsUsed,
+                                               timestepsReused, filter, singularityLimit, dataIDs, prec);
+      pp.setSinglePrecisionHistory(single == 1);
+      iterations[single] = iterateAffineProblem(pp, M, 5, 100, convergenceLimit);
+    }
+    BOOST_TEST(iterations[1] <= iterations[0]);
+  }
+}
+
+#ifdef EIGEN_RUNTIME_NO_MALLOC
+/// Once the history has reached its size, an iteration has to work in preallocated storage only.
+BOOST_AUTO_TEST_CASE(testNoAllocationInSteadyState)
 {
+  double           initialRelaxation        = 0.1;
+  int              maxIterationsUsed        = 20;
+  int              timestepsReused          = 1;
+  int              filter                   = cplscheme::impl::PostProcessing::QR1FILTER;
+  double           singularityLimit         = 1e-10;
+  bool             enforceInitialRelaxation = false;
+  std::vector<int> dataIDs{0, 1};
+
+  cplscheme::impl::PtrPreconditioner   precILS(new cplscheme::impl::ConstantPreconditioner({1.0, 1.0}));
+  cplscheme::impl::IQNILSPostProcessing ils(initialRelaxation, enforceInitialRelaxation, maxIterationsUsed,
+                                            timestepsReused, filter, singularityLimit, dataIDs, precILS);
+  cplscheme::impl::PtrPreconditioner  precIMVJ(new cplscheme::impl::ConstantPreconditioner({1.0, 1.0}));
+  cplscheme::impl::MVQNPostProcessing imvj(initialRelaxation, enforceInitialRelaxation, maxIterationsUsed,
+                                           timestepsReused, filter, singularityLimit, dataIDs, precIMVJ, false,
+                                           cplscheme::impl::MVQNPostProcessing::NO_RESTART, 0, 0, 0.0);
+
+  int             n = 20;
+  Eigen::MatrixXd M(2 * n, 2 * n);
+  for (int i = 0; i < 2 * n; i++) {
+    for (int j = 0; j < 2 * n; j++) {
+      M(i, j) = 0.5 / static_cast<double>(i + j + 1) + ((i == j) ? 0.3 : 0.0);
+    }
+  }
+
+  for (cplscheme::impl::PostProcessing *pp : std::vector<cplscheme::impl::PostProcessing *>{&ils, &imvj}) {
+    mesh::PtrMesh   dummyMesh(new mesh::Mesh("dummyMesh", 3, false));
+    Eigen::VectorXd dvalues = Eigen::VectorXd::Zero(n);
+    Eigen::VectorXd fvalues = Eigen::VectorXd::Zero(n);
+    PtrCouplingData dpcd(new CouplingData(&dvalues, dummyMesh, false, 1));
+    PtrCouplingData fpcd(new CouplingData(&fvalues, dummyMesh, false, 1));
+    std::map<int, PtrCouplingData> data;
+    data.insert(std::make_pair(0, dpcd));
+    data.insert(std::make_pair(1, fpcd));
+    pp->initialize(data);
+
+    // The first two time steps fill the history of the reused time step and the current one.
+    Eigen::VectorXd x = Eigen::VectorXd::Zero(2 * n);
+    for (int t = 0; t < 5; t++) {
+      Eigen::VectorXd b = Eigen::VectorXd::LinSpaced(2 * n, 1.0, 2.0 + t);
+      for (int k = 0; k < 8; k++) {
+        Eigen::VectorXd y      = M * x + b;
+        dpcd->oldValues.col(0) = x.head(n);
+        fpcd->oldValues.col(0) = x.tail(n);
+        dvalues                = y.head(n);
+        fvalues                = y.tail(n);
+        Eigen::internal::set_is_malloc_allowed(t < 2);
+        pp->performPostProcessing(data);
+        Eigen::internal::set_is_malloc_allowed(true);
+        x.head(n) = dvalues;
+        x.tail(n) = fvalues;
+      }
+      pp->iterationsConverged(data);
+      x.head(n) = dvalues;
+      x.tail(n) = fvalues;
+    }
+  }
+}
+#endif // EIGEN_RUNTIME_NO_MALLOC
+
+/// Body of testVIQNPP, with the W history stored in double or single precision.
+void runVIQNPP(bool singlePrecisionHistory)
+{
+  using DataMap = std::map<int, PtrCouplingData>;
+  // the W history in single precision only perturbs the quasi-Newton update by its round-off
+  double tolerance = singlePrecisionHistory ? 1e-6 : math::NUMERICAL_ZERO_DIFFERENCE;
+
   //use two vectors and see if underrelaxation works
 
   double initialRelaxation = 0.01;
@@ -208,6 +403,7 @@ BOOST_AUTO_TEST_CASE(testVIQNPP)
 
   cplscheme::impl::IQNILSPostProcessing pp(initialRelaxation, enforceInitialRelaxation, maxIterationsUsed,
       timestepsReused, filter, singularityLimit, dataIDs, prec);
+  pp.setSinglePrecisionHistory(singlePrecisionHistory);
 
 
   Eigen::VectorXd dvalues;
@@ -252,14 +448,14 @@ BOOST_AUTO_TEST_CASE(testVIQNPP)
 
   pp.performPostProcessing(data);
 
-  BOOST_TEST(testing::equals((*data.at(0)->values)(0), 1.00));
-  BOOST_TEST(testing::equals((*data.at(0)->values)(1), 1.01));
-  BOOST_TEST(testing::equals((*data.at(0)->values)(2), 1.02));
-  BOOST_TEST(testing::equals((*data.at(0)->values)(3), 1.03));
-  BOOST_TEST(testing::equals((*data.at(1)->values)(0), 0.199));
-  BOOST_TEST(testing::equals((*data.at(1)->values)(1), 0.199));
-  BOOST_TEST(testing::equals((*data.at(1)->values)(2), 0.199));
-  BOOST_TEST(testing::equals((*data.at(1)->values)(3), 0.199));
+  BOOST_TEST(testing::equals((*data.at(0)->values)(0), 1.00, tolerance));
+  BOOST_TEST(testing::equals((*data.at(0)->values)(1), 1.01, tolerance));
+  BOOST_TEST(testing::equals((*data.at(0)->values)(2), 1.02, tolerance));
+  BOOST_TEST(testing::equals((*data.at(0)->values)(3), 1.03, tolerance));
+  BOOST_TEST(testing::equals((*data.at(1)->values)(0), 0.199, tolerance));
+  BOOST_TEST(testing::equals((*data.at(1)->values)(1), 0.199, tolerance));
+  BOOST_TEST(testing::equals((*data.at(1)->values)(2), 0.199, tolerance));
+  BOOST_TEST(testing::equals((*data.at(1)->values)(3), 0.199, tolerance));
 
   Eigen::VectorXd newdvalues;
   utils::append(newdvalues, 10.0);
@@ -270,14 +466,24 @@ BOOST_AUTO_TEST_CASE(testVIQNPP)
 
   pp.performPostProcessing(data);
 
-  BOOST_TEST(testing::equals((*data.at(0)->values)(0), -5.63401340929692295845e-01));
-  BOOST_TEST(testing::equals((*data.at(0)->values)(1), 6.10309919173607440257e-01));
-  BOOST_TEST(testing::equals((*data.at(0)->values)(2), 1.78402117927690717636e+00));
-  BOOST_TEST(testing::equals((*data.at(0)->values)(3), 2.95773243938020513610e+00));
-  BOOST_TEST(testing::equals((*data.at(1)->values)(0), 8.28025852497733944046e-02));
-  BOOST_TEST(testing::equals((*data.at(1)->values)(1), 8.28025852497733944046e-02));
-  BOOST_TEST(testing::equals((*data.at(1)->values)(2), 8.28025852497733944046e-02));
-  BOOST_TEST(testing::equals((*data.at(1)->values)(3), 8.28025852497733944046e-02));
+  BOOST_TEST(testing::equals((*data.at(0)->values)(0), -5.63401340929692295845e-01, tolerance));
+  BOOST_TEST(testing::equals((*data.at(0)->values)(1), 6.10309919173607440257e-01, tolerance));
+  BOOST_TEST(testing::equals((*data.at(0)->values)(2), 1.78402117927690717636e+00, tolerance));
+  BOOST_TEST(testing::equals((*data.at(0)->values)(3), 2.95773243938020513610e+00, tolerance));
+  BOOST_TEST(testing::equals((*data.at(1)->values)(0), 8.28025852497733944046e-02, tolerance));
+  BOOST_TEST(testing::equals((*data.at(1)->values)(1), 8.28025852497733944046e-02, tolerance));
+  BOOST_TEST(testing::equals((*data.at(1)->values)(2), 8.28025852497733944046e-02, tolerance));
+  BOOST_TEST(testing::equals((*data.at(1)->values)(3), 8.28025852497733944046e-02, tolerance));
+}
+
+BOOST_AUTO_TEST_CASE(testVIQNPP)
+{
+  runVIQNPP(false);
+}
+
+BOOST_AUTO_TEST_CASE(testVIQNPPSinglePrecisionHistory)
+{
+  runVIQNPP(true);
 }
 
 /// Test that runs on 2 processors.
@@ -10,6 +10,7 @@
 #include "testing/Testing.hpp"
 #include "utils/MasterSlave.hpp"
 #include "utils/Parallel.hpp"
+#include "utils/ThreadPool.hpp"
 
 BOOST_AUTO_TEST_SUITE(CplSchemeTests)
 
@@ -328,6 +329,18 @@ BOOST_AUTO_TEST_CASE(ParallelMatrixMatrixOp,  * boost::unit_test::fixture<testin
   Eigen::MatrixXd matrix_cast = resJres_local2;
   validate_result_equals_reference(matrix_cast, Jres_global, vertexOffsets, true);
 
+  // 6.) repeat the cyclic multiplications with the local block products distributed among threads
+  utils::ThreadPool::getInstance().setSize(2);
+  utils::ThreadPool::getInstance().setMinChunkSize(1);
+  Eigen::MatrixXd resJW_local3(n_local, m_global);
+  parMatrixOps.multiply(J_local, W_local, resJW_local3, vertexOffsets, n_global, n_global, m_global);
+  validate_result_equals_reference(resJW_local3, JW_global, vertexOffsets, true);
+  Eigen::MatrixXd resJres_local3(n_local, 1);
+  parMatrixOps.multiply(J_local, res_local, resJres_local3, vertexOffsets, n_global, n_global, 1);
+  validate_result_equals_reference(resJres_local3, Jres_global, vertexOffsets, true);
+  utils::ThreadPool::getInstance().setSize(1);
+  utils::ThreadPool::getInstance().setMinChunkSize(8192);
+
   // close and shut down cyclic communication connections
   if (_cyclicCommRight != nullptr || _cyclicCommLeft != nullptr) {
     if ((utils::Parallel::getProcessRank() % 2) == 0) {
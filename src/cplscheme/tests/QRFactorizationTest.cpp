@@ -4,17 +4,29 @@
 #include <Eigen/Core>
 #include "cplscheme/impl/BaseQNPostProcessing.hpp"
 #include "cplscheme/impl/QRFactorization.hpp"
+#include "testing/Fixtures.hpp"
 #include "testing/Testing.hpp"
+#include "utils/MasterSlave.hpp"
 
 BOOST_AUTO_TEST_SUITE(CplSchemeTests)
 
 using namespace precice;
 using namespace cplscheme;
 
+/// Sets A to the Hilbert matrix, shifted by the given row offset.
+void fillHilbert(Eigen::MatrixXd &A, int rowOffset = 0)
+{
+  for (int i = 0; i < A.rows(); i++) {
+    for (int j = 0; j < A.cols(); j++) {
+      A(i, j) = 1.0 / static_cast<double>(i + rowOffset + j + 1);
+    }
+  }
+}
+
 void testQRequalsA(
-    Eigen::MatrixXd &Q,
-    Eigen::MatrixXd &R,
-    Eigen::MatrixXd &A)
+    const Eigen::MatrixXd &Q,
+    const Eigen::MatrixXd &R,
+    const Eigen::MatrixXd &A)
 {
   Eigen::MatrixXd A_prime = Q * R;
 
@@ -25,7 +37,7 @@ void testQRequalsA(
   }
 }
 
-void testQTQequalsIdentity(Eigen::MatrixXd &Q)
+void testQTQequalsIdentity(const Eigen::MatrixXd &Q)
 {
   Eigen::MatrixXd QTQ = Q.transpose() * Q;
 
@@ -146,4 +158,92 @@ BOOST_AUTO_TEST_CASE(testQRFactorization)
   testQRequalsA(qr_1.matrixQ(), qr_1.matrixR(), A);
 }
 
+BOOST_AUTO_TEST_CASE(testQRFactorizationCGS2)
+{
+  int             m = 6, n = 8;
+  int             filter = impl::BaseQNPostProcessing::QR1FILTER;
+  Eigen::MatrixXd A(n, m);
+  fillHilbert(A);
+
+  impl::QRFactorization qr_mgs(A, filter);
+  impl::QRFactorization qr_cgs2(filter);
+  qr_cgs2.setOrthogonalization(impl::QRFactorization::CGS2);
+  qr_cgs2.setGlobalRows(n);
+  for (int k = 0; k < m; k++) {
+    Eigen::VectorXd v = A.col(k);
+    qr_cgs2.pushBack(v);
+  }
+
+  testQTQequalsIdentity(qr_cgs2.matrixQ());
+  testQRequalsA(qr_cgs2.matrixQ(), qr_cgs2.matrixR(), A);
+  BOOST_TEST(testing::equals(qr_cgs2.matrixR(), qr_mgs.matrixR(), 1e-10));
+
+  // ----------- delete and re-insert middle column ---------------
+  int             k    = 3;
+  Eigen::VectorXd colk = A.col(k);
+  qr_cgs2.deleteColumn(k);
+  qr_cgs2.insertColumn(k, colk);
+  testQTQequalsIdentity(qr_cgs2.matrixQ());
+  testQRequalsA(qr_cgs2.matrixQ(), qr_cgs2.matrixR(), A);
+}
+
+BOOST_AUTO_TEST_CASE(testQRFactorizationStorage)
+{
+  int             m = 4, n = 10;
+  int             filter = impl::BaseQNPostProcessing::QR1FILTER;
+  Eigen::MatrixXd A(n, m + 6);
+  fillHilbert(A);
+  A += Eigen::MatrixXd::Identity(n, m + 6);
+
+  impl::QRFactorization qr(filter);
+  qr.setGlobalRows(n);
+  for (int k = 0; k < m; k++) {
+    Eigen::VectorXd v = A.col(k);
+    qr.pushFront(v);
+  }
+  const double *dataQ = qr.matrixQ().data();
+  const double *dataR = qr.matrixR().data();
+
+  // the update pattern of the quasi-Newton post-processing, i.e., the oldest column is
+  // dropped and a new one is inserted in front, reuses the storage once the column count is settled
+  for (int k = m; k < A.cols(); k++) {
+    qr.popBack();
+    Eigen::VectorXd v = A.col(k);
+    qr.pushFront(v);
+
+    Eigen::MatrixXd reference = A.middleCols(k - m + 1, m).rowwise().reverse();
+    testQTQequalsIdentity(qr.matrixQ());
+    testQRequalsA(qr.matrixQ(), qr.matrixR(), reference);
+    BOOST_TEST(qr.matrixQ().data() == dataQ);
+    BOOST_TEST(qr.matrixR().data() == dataR);
+  }
+}
+
+#ifndef PRECICE_NO_MPI
+BOOST_AUTO_TEST_CASE(testQRFactorizationCGS2MasterSlave,
+                     *testing::OnSize(4) * boost::unit_test::fixture<testing::MasterComFixture>())
+{
+  // every rank holds two rows of the 8x6 Hilbert matrix
+  int             m = 6, n = 2;
+  int             filter = impl::BaseQNPostProcessing::QR1FILTER;
+  Eigen::MatrixXd A(n, m);
+  fillHilbert(A, n * utils::MasterSlave::_rank);
+
+  impl::QRFactorization qr(filter);
+  qr.setOrthogonalization(impl::QRFactorization::CGS2);
+  qr.setGlobalRows(4 * n);
+  for (int k = 0; k < m; k++) {
+    Eigen::VectorXd v = A.col(k);
+    qr.pushBack(v);
+  }
+
+  testQRequalsA(qr.matrixQ(), qr.matrixR(), A);
+
+  Eigen::MatrixXd localQTQ  = qr.matrixQ().transpose() * qr.matrixQ();
+  Eigen::MatrixXd globalQTQ = Eigen::MatrixXd::Zero(m, m);
+  utils::MasterSlave::allreduceSum(localQTQ.data(), globalQTQ.data(), m * m);
+  BOOST_TEST(testing::equals(globalQTQ, Eigen::MatrixXd::Identity(m, m), 1e-12));
+}
+#endif // not PRECICE_NO_MPI
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,276 @@
+#include "Compressor.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "utils/EventTimings.hpp"
+#include "utils/assertion.hpp"
+
+using precice::utils::Event;
+
+namespace precice
+{
+namespace m2n
+{
+
+namespace
+{
+
+/**
+ * @brief Appends the bytes run-length encoded to the output.
+ *
+ * Uses the PackBits scheme: A control byte c < 128 is followed by c + 1 literal
+ * bytes, a control byte c >= 128 is followed by one byte, which is repeated
+ * c - 125 times.
+ */
+void encodeRuns(std::vector<unsigned char> const &bytes, std::vector<unsigned char> &output)
+{
+  size_t i = 0;
+
+  while (i < bytes.size()) {
+    size_t run = 1;
+    while (i + run < bytes.size() && run < 130 && bytes[i + run] == bytes[i]) {
+      run++;
+    }
+
+    if (run >= 3) {
+      output.push_back(static_cast<unsigned char>(run + 125));
+      output.push_back(bytes[i]);
+      i += run;
+      continue;
+    }
+
+    // Literal bytes up to the next run of at least three equal bytes.
+    size_t begin = i;
+    while (i < bytes.size() && i - begin < 128) {
+      if (i + 2 < bytes.size() && bytes[i] == bytes[i + 1] && bytes[i] == bytes[i + 2]) {
+        break;
+      }
+      i++;
+    }
+    output.push_back(static_cast<unsigned char>(i - begin - 1));
+    output.insert(output.end(), bytes.begin() + begin, bytes.begin() + i);
+  }
+}
+
+/// Decodes bytes encoded by encodeRuns().
+void decodeRuns(const unsigned char *input, size_t size, std::vector<unsigned char> &bytes)
+{
+  bytes.clear();
+  size_t i = 0;
+
+  while (i < size) {
+    unsigned char control = input[i++];
+
+    if (control < 128) {
+      size_t count = control + 1;
+      assertion(i + count <= size);
+      bytes.insert(bytes.end(), input + i, input + i + count);
+      i += count;
+    } else {
+      size_t count = control - 125;
+      assertion(i < size);
+      bytes.insert(bytes.end(), count, input[i++]);
+    }
+  }
+}
+
+/// Appends the bytes of the words, such that bytes of equal significance are adjacent.
+void appendShuffled(std::vector<std::uint64_t> const &words, std::vector<unsigned char> &bytes)
+{
+  size_t offset = bytes.size();
+  size_t count  = words.size();
+  bytes.resize(offset + count * sizeof(std::uint64_t));
+
+  for (size_t i = 0; i < count; i++) {
+    for (size_t b = 0; b < sizeof(std::uint64_t); b++) {
+      bytes[offset + b * count + i] = static_cast<unsigned char>(words[i] >> (8 * b));
+    }
+  }
+}
+
+/// Reassembles the words from bytes shuffled by appendShuffled().
+void extractShuffled(const unsigned char *bytes, std::vector<std::uint64_t> &words)
+{
+  size_t count = words.size();
+
+  for (size_t i = 0; i < count; i++) {
+    std::uint64_t word = 0;
+    for (size_t b = 0; b < sizeof(std::uint64_t); b++) {
+      word |= std::uint64_t(bytes[b * count + i]) << (8 * b);
+    }
+    words[i] = word;
+  }
+}
+
+} // namespace
+
+Compressor::Compressor(std::string const &name, Mode mode, double tolerance)
+    : _name(name),
+      _mode(mode),
+      _tolerance(tolerance)
+{
+  if (_mode == Mode::LOSSY) {
+    assertion(tolerance > 0.0, tolerance);
+    // Keeping m mantissa bits bounds the relative error by 2^-m.
+    int keptBits   = static_cast<int>(std::ceil(-std::log2(tolerance)));
+    _truncatedBits = 52 - std::min(std::max(keptBits, 0), 52);
+  }
+}
+
+void Compressor::compress(int channel, const double *values, int size, std::vector<int> &encoded)
+{
+  Event e("M2N::compress/" + _name);
+
+  if (_mode == Mode::SPARSE) {
+    encodeChanges(channel, values, size);
+  } else {
+    const std::uint64_t mask = ~((std::uint64_t(1) << _truncatedBits) - 1);
+
+    std::vector<std::uint64_t> *last = nullptr;
+    if (_mode != Mode::LOSSLESS) {
+      last = &transmitted(channel, size);
+    }
+
+    _words.resize(size);
+    for (int i = 0; i < size; i++) {
+      std::uint64_t word;
+      std::memcpy(&word, values + i, sizeof(word));
+      word &= mask;
+
+      _words[i] = word;
+      if (last) {
+        _words[i] ^= (*last)[i];
+        (*last)[i] = word;
+      }
+    }
+
+    _bytes.clear();
+    appendShuffled(_words, _bytes);
+  }
+
+  std::vector<unsigned char> output;
+  output.reserve(_bytes.size() / 4);
+  encodeRuns(_bytes, output);
+
+  // Number of encoded bytes, followed by the bytes packed into integers.
+  encoded.assign(1 + (output.size() + sizeof(int) - 1) / sizeof(int), 0);
+  encoded[0] = output.size();
+  std::memcpy(encoded.data() + 1, output.data(), output.size());
+
+  if (size > 0) {
+    e.data.push_back(static_cast<int>(100 * encoded.size() * sizeof(int) / (size * sizeof(double))));
+  }
+}
+
+void Compressor::decompress(int channel, std::vector<int> const &encoded, double *values, int size)
+{
+  Event e("M2N::decompress/" + _name);
+
+  assertion(not encoded.empty());
+  decodeRuns(reinterpret_cast<const unsigned char *>(encoded.data() + 1), encoded[0], _bytes);
+
+  if (_mode == Mode::SPARSE) {
+    decodeChanges(channel, values, size);
+    return;
+  }
+
+  std::vector<std::uint64_t> *last = nullptr;
+  if (_mode != Mode::LOSSLESS) {
+    last = &transmitted(channel, size);
+  }
+
+  assertion(_bytes.size() == size * sizeof(double), _bytes.size(), size);
+  _words.resize(size);
+  extractShuffled(_bytes.data(), _words);
+
+  for (int i = 0; i < size; i++) {
+    std::uint64_t word = _words[i];
+
+    if (last) {
+      word ^= (*last)[i];
+      (*last)[i] = word;
+    }
+
+    std::memcpy(values + i, &word, sizeof(word));
+  }
+}
+
+void Compressor::encodeChanges(int channel, const double *values, int size)
+{
+  auto &last = transmitted(channel, size);
+
+  _words.clear();
+  _changes.assign((size + 7) / 8, 0);
+
+  for (int i = 0; i < size; i++) {
+    std::uint64_t word;
+    std::memcpy(&word, values + i, sizeof(word));
+
+    double lastValue;
+    std::memcpy(&lastValue, &last[i], sizeof(lastValue));
+
+    bool changed = (_tolerance == 0.0) ? word != last[i]
+                                       : not(std::abs(values[i] - lastValue) <= _tolerance * std::abs(lastValue));
+    if (changed) {
+      _changes[i / 8] |= 1 << (i % 8);
+      _words.push_back(word);
+    }
+  }
+
+  // The bitmap only pays off, if it is smaller than the values left out.
+  bool dense = _changes.size() >= (size - _words.size()) * sizeof(std::uint64_t);
+
+  _bytes.clear();
+  if (dense) {
+    _bytes.push_back(0);
+    _words.resize(size);
+    std::memcpy(_words.data(), values, size * sizeof(double));
+    last = _words;
+  } else {
+    _bytes.push_back(1);
+    _bytes.insert(_bytes.end(), _changes.begin(), _changes.end());
+    for (int i = 0, k = 0; i < size; i++) {
+      if (_changes[i / 8] & (1 << (i % 8))) {
+        last[i] = _words[k++];
+      }
+    }
+  }
+  appendShuffled(_words, _bytes);
+}
+
+void Compressor::decodeChanges(int channel, double *values, int size)
+{
+  auto &last = transmitted(channel, size);
+
+  assertion(not _bytes.empty());
+  bool dense = _bytes[0] == 0;
+
+  if (dense) {
+    assertion(_bytes.size() == 1 + size * sizeof(double), _bytes.size(), size);
+    extractShuffled(_bytes.data() + 1, last);
+  } else {
+    const unsigned char *changes = _bytes.data() + 1;
+    size_t               bitmapSize = (size + 7) / 8;
+    _words.resize((_bytes.size() - 1 - bitmapSize) / sizeof(std::uint64_t));
+    extractShuffled(changes + bitmapSize, _words);
+    for (int i = 0, k = 0; i < size; i++) {
+      if (changes[i / 8] & (1 << (i % 8))) {
+        last[i] = _words[k++];
+      }
+    }
+  }
+
+  std::memcpy(values, last.data(), size * sizeof(double));
+}
+
+std::vector<std::uint64_t> &Compressor::transmitted(int channel, int size)
+{
+  auto &last = _transmitted[channel];
+  if (static_cast<int>(last.size()) != size) {
+    last.assign(size, 0);
+  }
+  return last;
+}
+
+} // namespace m2n
+} // namespace precice
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include "logging/Logger.hpp"
+
+namespace precice
+{
+namespace m2n
+{
+
+/**
+ * @brief Compresses the values of exchanged data before they are sent to a remote participant.
+ *
+ * All modes shuffle the bytes of the values, such that bytes of equal significance
+ * are adjacent, and encode runs of equal bytes. Smooth data yields long runs in the
+ * sign and exponent bytes.
+ *
+ * - LOSSLESS only shuffles and encodes the values.
+ * - DELTA additionally XORs the values with the values transmitted last on the same
+ *   channel, such that bits that did not change become zero.
+ * - LOSSY additionally clears the low mantissa bits, which are not needed for the
+ *   given relative tolerance, before applying DELTA.
+ * - SPARSE only sends the values, which changed by more than the relative tolerance,
+ *   together with a bitmap of the changed values. The receiver keeps the values transmitted
+ *   last for all others. If the bitmap does not pay off, all values are sent.
+ *
+ * The values transmitted last are stored per channel, i.e. per remote process. Hence,
+ * sender and receiver have to encode and decode the same sequence of messages per channel.
+ * Compression ratio and time are reported as events "M2N::compress/<name>" and
+ * "M2N::decompress/<name>", with the size of the encoded data in percent of the raw data.
+ */
+class Compressor
+{
+public:
+  enum class Mode {
+    LOSSLESS,
+    DELTA,
+    LOSSY,
+    SPARSE
+  };
+
+  /**
+   * @param[in] name Name of the compressed data, used for the events.
+   * @param[in] mode Compression mode.
+   * @param[in] tolerance Relative tolerance of the LOSSY and SPARSE modes.
+   */
+  Compressor(std::string const &name, Mode mode, double tolerance = 0.0);
+
+  /// Encodes the values to be sent on the given channel.
+  void compress(int channel, const double *values, int size, std::vector<int> &encoded);
+
+  /// Decodes values, which have been encoded by compress() for the same channel.
+  void decompress(int channel, std::vector<int> const &encoded, double *values, int size);
+
+private:
+  logging::Logger _log{"m2n::Compressor"};
+
+  std::string _name;
+
+  Mode _mode;
+
+  double _tolerance;
+
+  /// Number of low mantissa bits cleared by the LOSSY mode.
+  int _truncatedBits = 0;
+
+  /// Values transmitted last on each channel, used by the DELTA and LOSSY modes.
+  std::map<int, std::vector<std::uint64_t>> _transmitted;
+
+  /// Shuffled bytes of the current message.
+  std::vector<unsigned char> _bytes;
+
+  /// Words of the current message.
+  std::vector<std::uint64_t> _words;
+
+  /// Bitmap of the values changed in the current message, used by the SPARSE mode.
+  std::vector<unsigned char> _changes;
+
+  /// Returns the values transmitted last on the channel, resized and zeroed if the size changed.
+  std::vector<std::uint64_t> &transmitted(int channel, int size);
+
+  /// Writes the changed values and their bitmap, or all values, to the bytes of the current message.
+  void encodeChanges(int channel, const double *values, int size);
+
+  /// Updates the values transmitted last by the bytes written by encodeChanges().
+  void decodeChanges(int channel, double *values, int size);
+};
+
+} // namespace m2n
+} // namespace precice
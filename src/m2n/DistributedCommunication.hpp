@@ -1,5 +1,8 @@
 #pragma once
 
+#include <string>
+#include <vector>
+#include "SharedPointer.hpp"
 #include "mesh/SharedPointer.hpp"
 
 namespace precice
@@ -63,6 +66,32 @@ public:
       const std::string &nameAcceptor,
       const std::string &nameRequester) = 0;
 
+  /**
+   * @brief Connects to the given ranks of another participant only, which has to call requestPreConnection().
+   *
+   * Used to exchange the mesh directly between the ranks of both participants before it is partitioned.
+   */
+  virtual void acceptPreConnection(
+      const std::string &     nameAcceptor,
+      const std::string &     nameRequester,
+      const std::vector<int> &remoteRanks) = 0;
+
+  /// Connects to the given ranks of another participant only, which has to call acceptPreConnection().
+  virtual void requestPreConnection(
+      const std::string &     nameAcceptor,
+      const std::string &     nameRequester,
+      const std::vector<int> &remoteRanks) = 0;
+
+  /// Sends a mesh to a connected rank of the remote participant.
+  virtual void sendMesh(
+      mesh::Mesh &mesh,
+      int         remoteRank) = 0;
+
+  /// Receives a mesh from a connected rank of the remote participant and adds it to the given mesh.
+  virtual void receiveMesh(
+      mesh::Mesh &mesh,
+      int         remoteRank) = 0;
+
   /**
    * @brief Disconnects from communication space, i.e. participant.
    *
@@ -70,17 +99,24 @@ public:
    */
   virtual void closeConnection() = 0;
 
-  /// Sends an array of double values from all slaves (different for each slave).
+  /**
+   * @brief Sends an array of double values from all slaves (different for each slave).
+   *
+   * If a compressor is given, the values are sent compressed. The receiving participant
+   * has to use a compressor with the same mode.
+   */
   virtual void send(
-      double *itemsToSend,
-      size_t  size,
-      int     valueDimension) = 0;
+      double *    itemsToSend,
+      size_t      size,
+      int         valueDimension,
+      Compressor *compressor = nullptr) = 0;
 
-  /// All slaves receive an array of doubles (different for each slave).
+  /// All slaves receive an array of doubles (different for each slave), decompressed if a compressor is given.
   virtual void receive(
-      double *itemsToReceive,
-      size_t  size,
-      int     valueDimension) = 0;
+      double *    itemsToReceive,
+      size_t      size,
+      int         valueDimension,
+      Compressor *compressor = nullptr) = 0;
 
 protected:
   /**
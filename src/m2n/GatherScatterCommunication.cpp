@@ -1,5 +1,8 @@
 #include "GatherScatterCommunication.hpp"
+#include <algorithm>
+#include "Compressor.hpp"
 #include "com/Communication.hpp"
+#include "com/Request.hpp"
 #include "mesh/Mesh.hpp"
 #include "utils/MasterSlave.hpp"
 
@@ -7,6 +10,108 @@ namespace precice
 {
 namespace m2n
 {
+
+namespace
+{
+
+/// Returns the number of chunks, in which the values of the given number of vertices are exchanged.
+int chunkCount(int vertexCount)
+{
+  return (vertexCount + GatherScatterCommunication::CHUNK_VERTICES - 1) / GatherScatterCommunication::CHUNK_VERTICES;
+}
+
+/// Returns the range of values [begin, end) of the given chunk.
+std::pair<int, int> chunkRange(int chunk, int vertexCount, int valueDimension)
+{
+  int begin = chunk * GatherScatterCommunication::CHUNK_VERTICES;
+  int end   = std::min(begin + GatherScatterCommunication::CHUNK_VERTICES, vertexCount);
+  return {begin * valueDimension, end * valueDimension};
+}
+
+/// Returns the chunks, in ascending order, which contain any of the given vertices.
+std::vector<int> chunksOf(std::vector<int> const &vertices)
+{
+  std::vector<int> chunks;
+  chunks.reserve(vertices.size());
+  for (int vertex : vertices) {
+    chunks.push_back(vertex / GatherScatterCommunication::CHUNK_VERTICES);
+  }
+  std::sort(chunks.begin(), chunks.end());
+  chunks.erase(std::unique(chunks.begin(), chunks.end()), chunks.end());
+  return chunks;
+}
+
+/// Sends the values of a chunk, compressed on the channel of the chunk if a compressor is given.
+com::PtrRequest aSendChunk(
+    com::Communication &communication,
+    const double *      values,
+    int                 size,
+    int                 chunk,
+    Compressor *        compressor,
+    std::vector<int> &  encoded)
+{
+  if (not compressor) {
+    return communication.aSend(values, size, 0);
+  }
+  compressor->compress(chunk, values, size, encoded);
+  communication.send(static_cast<int>(encoded.size()), 0);
+  return communication.aSend(encoded.data(), encoded.size(), 0);
+}
+
+/// Receives the values of a chunk sent by aSendChunk().
+void receiveChunk(
+    com::Communication &communication,
+    double *            values,
+    int                 size,
+    int                 chunk,
+    Compressor *        compressor,
+    std::vector<int> &  encoded)
+{
+  if (not compressor) {
+    communication.receive(values, size, 0);
+    return;
+  }
+  int encodedSize = 0;
+  communication.receive(encodedSize, 0);
+  encoded.resize(encodedSize);
+  communication.receive(encoded.data(), encodedSize, 0);
+  compressor->decompress(chunk, encoded, values, size);
+}
+
+} // namespace
+
+void GatherScatterCommunication::sendChunks(
+    com::Communication &communication,
+    const double *      itemsToSend,
+    int                 size,
+    int                 valueDimension,
+    Compressor *        compressor)
+{
+  std::vector<int> encoded;
+  int              vertexCount = size / valueDimension;
+  for (int chunk = 0; chunk < chunkCount(vertexCount); chunk++) {
+    auto range = chunkRange(chunk, vertexCount, valueDimension);
+    aSendChunk(communication, itemsToSend + range.first, range.second - range.first,
+               chunk, compressor, encoded)
+        ->wait();
+  }
+}
+
+void GatherScatterCommunication::receiveChunks(
+    com::Communication &communication,
+    double *            itemsToReceive,
+    int                 size,
+    int                 valueDimension,
+    Compressor *        compressor)
+{
+  std::vector<int> encoded;
+  int              vertexCount = size / valueDimension;
+  for (int chunk = 0; chunk < chunkCount(vertexCount); chunk++) {
+    auto range = chunkRange(chunk, vertexCount, valueDimension);
+    receiveChunk(communication, itemsToReceive + range.first, range.second - range.first,
+                 chunk, compressor, encoded);
+  }
+}
 GatherScatterCommunication::GatherScatterCommunication(
     com::PtrCommunication com,
     mesh::PtrMesh         mesh)
@@ -46,6 +151,38 @@ void GatherScatterCommunication::requestConnection(
   _isConnected = true;
 }
 
+void GatherScatterCommunication::acceptPreConnection(
+    const std::string &,
+    const std::string &,
+    const std::vector<int> &)
+{
+  ERROR("A gather-scatter communication does not support a direct exchange of meshes. "
+        << "Please use distribution-type point-to-point instead.");
+}
+
+void GatherScatterCommunication::requestPreConnection(
+    const std::string &,
+    const std::string &,
+    const std::vector<int> &)
+{
+  ERROR("A gather-scatter communication does not support a direct exchange of meshes. "
+        << "Please use distribution-type point-to-point instead.");
+}
+
+void GatherScatterCommunication::sendMesh(
+    mesh::Mesh &,
+    int)
+{
+  ERROR("A gather-scatter communication does not support a direct exchange of meshes.");
+}
+
+void GatherScatterCommunication::receiveMesh(
+    mesh::Mesh &,
+    int)
+{
+  ERROR("A gather-scatter communication does not support a direct exchange of meshes.");
+}
+
 void GatherScatterCommunication::closeConnection()
 {
   TRACE();
@@ -54,9 +191,10 @@ void GatherScatterCommunication::closeConnection()
 }
 
 void GatherScatterCommunication::send(
-    double *itemsToSend,
-    size_t  size,
-    int     valueDimension)
+    double *    itemsToSend,
+    size_t      size,
+    int         valueDimension,
+    Compressor *compressor)
 {
   TRACE(size);
   assertion(utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode);
@@ -65,8 +203,6 @@ void GatherScatterCommunication::send(
   assertion(utils::MasterSlave::_size > 1);
   assertion(utils::MasterSlave::_rank != -1);
 
-  double *globalItemsToSend = nullptr;
-
   //gatherData
   if (utils::MasterSlave::_slaveMode) { //slave
     if (size > 0) {
@@ -74,38 +210,79 @@ void GatherScatterCommunication::send(
     }
   } else { //master
     assertion(utils::MasterSlave::_rank == 0);
-    mesh::Mesh::VertexDistribution        &vertexDistribution = _mesh->getVertexDistribution();
-    int                              globalSize         = _mesh->getGlobalNumberOfVertices() * valueDimension;
+    mesh::Mesh::VertexDistribution &vertexDistribution = _mesh->getVertexDistribution();
+    int                             globalVertexCount  = _mesh->getGlobalNumberOfVertices();
+    int                             globalSize         = globalVertexCount * valueDimension;
     DEBUG("Global Size = " << globalSize);
-    globalItemsToSend = new double[globalSize]();
-
-    //master data
-    for (size_t i = 0; i < vertexDistribution[0].size(); i++) {
-      for (int j = 0; j < valueDimension; j++) {
-        globalItemsToSend[vertexDistribution[0][i] * valueDimension + j] += itemsToSend[i * valueDimension + j];
-      }
-    }
+    _globalBuffer.assign(globalSize, 0.0);
+    _slaveBuffers.resize(utils::MasterSlave::_size);
 
-    //slaves data
+    //post receives of all slaves at once
+    std::vector<com::PtrRequest> requests;
+    std::vector<int>             requestRanks;
     for (int rankSlave = 1; rankSlave < utils::MasterSlave::_size; rankSlave++) {
       int slaveSize = vertexDistribution[rankSlave].size() * valueDimension;
       DEBUG("Slave Size = " << slaveSize);
       if (slaveSize > 0) {
-        double *valuesSlave = new double[slaveSize];
-        utils::MasterSlave::_communication->receive(valuesSlave, slaveSize, rankSlave);
-        for (size_t i = 0; i < vertexDistribution[rankSlave].size(); i++) {
-          for (int j = 0; j < valueDimension; j++) {
-            globalItemsToSend[vertexDistribution[rankSlave][i] * valueDimension + j] += valuesSlave[i * valueDimension + j];
-          }
+        _slaveBuffers[rankSlave].resize(slaveSize);
+        requests.push_back(utils::MasterSlave::_communication->aReceive(
+            _slaveBuffers[rankSlave].data(), slaveSize, rankSlave));
+        requestRanks.push_back(rankSlave);
+      }
+    }
+
+    //number of ranks, whose values are still missing in each chunk
+    int                           chunks = chunkCount(globalVertexCount);
+    std::vector<int>              missingRanks(chunks, 0);
+    std::vector<std::vector<int>> rankChunks(utils::MasterSlave::_size);
+    for (int rank = 0; rank < utils::MasterSlave::_size; rank++) {
+      rankChunks[rank] = chunksOf(vertexDistribution[rank]);
+      for (int chunk : rankChunks[rank]) {
+        missingRanks[chunk]++;
+      }
+    }
+
+    //send complete chunks to other master in order, with at most one send in flight
+    int             nextChunk = 0;
+    com::PtrRequest sendRequest;
+    auto            sendCompleteChunks = [&]() {
+      while (nextChunk < chunks && missingRanks[nextChunk] == 0) {
+        if (sendRequest) {
+          sendRequest->wait();
+        }
+        auto range  = chunkRange(nextChunk, globalVertexCount, valueDimension);
+        sendRequest = aSendChunk(*_com, &_globalBuffer[range.first], range.second - range.first,
+                                 nextChunk, compressor, _encoded);
+        nextChunk++;
+      }
+    };
+
+    auto merge = [&](int rank, const double *values) {
+      std::vector<int> const &vertices = vertexDistribution[rank];
+      for (size_t i = 0; i < vertices.size(); i++) {
+        for (int j = 0; j < valueDimension; j++) {
+          _globalBuffer[vertices[i] * valueDimension + j] += values[i * valueDimension + j];
         }
-        delete[] valuesSlave;
       }
+      for (int chunk : rankChunks[rank]) {
+        missingRanks[chunk]--;
+      }
+      sendCompleteChunks();
+    };
+
+    //master data
+    merge(0, itemsToSend);
+
+    //slaves data, in order of arrival
+    int index = -1;
+    while ((index = com::Request::waitAny(requests)) != -1) {
+      merge(requestRanks[index], _slaveBuffers[requestRanks[index]].data());
     }
 
-    //send data to other master
-    assertion(globalItemsToSend != nullptr);
-    _com->send(globalItemsToSend, globalSize, 0);
-    delete[] globalItemsToSend;
+    assertion(nextChunk == chunks, nextChunk, chunks);
+    if (sendRequest) {
+      sendRequest->wait();
+    }
   } //master
 }
 
@@ -115,9 +292,10 @@ void GatherScatterCommunication::send(
  * @return Rank of sender, which is useful when ANY_SENDER is used.
  */
 void GatherScatterCommunication::receive(
-    double *itemsToReceive,
-    size_t  size,
-    int     valueDimension)
+    double *    itemsToReceive,
+    size_t      size,
+    int         valueDimension,
+    Compressor *compressor)
 {
   TRACE(size);
   assertion(utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode);
@@ -126,16 +304,6 @@ void GatherScatterCommunication::receive(
   assertion(utils::MasterSlave::_size > 1);
   assertion(utils::MasterSlave::_rank != -1);
 
-  double *globalItemsToReceive = nullptr;
-
-  //receive data at master
-  if (utils::MasterSlave::_masterMode) {
-    int globalSize = _mesh->getGlobalNumberOfVertices() * valueDimension;
-    DEBUG("Global Size = " << globalSize);
-    globalItemsToReceive = new double[globalSize];
-    _com->receive(globalItemsToReceive, globalSize, 0);
-  }
-
   //scatter data
   if (utils::MasterSlave::_slaveMode) { //slave
     if (size > 0) {
@@ -146,31 +314,69 @@ void GatherScatterCommunication::receive(
   } else { //master
     assertion(utils::MasterSlave::_rank == 0);
     mesh::Mesh::VertexDistribution &vertexDistribution = _mesh->getVertexDistribution();
+    int                             globalVertexCount  = _mesh->getGlobalNumberOfVertices();
+    int                             globalSize         = globalVertexCount * valueDimension;
+    DEBUG("Global Size = " << globalSize);
+    _globalBuffer.resize(globalSize);
+    _slaveBuffers.resize(utils::MasterSlave::_size);
 
-    //master data
-    for (size_t i = 0; i < vertexDistribution[0].size(); i++) {
-      for (int j = 0; j < valueDimension; j++) {
-        itemsToReceive[i * valueDimension + j] = globalItemsToReceive[vertexDistribution[0][i] * valueDimension + j];
+    //ranks, whose values are complete once a chunk has been received
+    int                           chunks = chunkCount(globalVertexCount);
+    std::vector<std::vector<int>> completeRanks(chunks);
+    for (int rank = 0; rank < utils::MasterSlave::_size; rank++) {
+      std::vector<int> rankChunks = chunksOf(vertexDistribution[rank]);
+      if (not rankChunks.empty()) {
+        completeRanks[rankChunks.back()].push_back(rank);
       }
     }
 
-    //slaves data
-    for (int rankSlave = 1; rankSlave < utils::MasterSlave::_size; rankSlave++) {
-      int slaveSize = vertexDistribution[rankSlave].size() * valueDimension;
-      DEBUG("Slave Size = " << slaveSize);
-      if (slaveSize > 0) {
-        double *valuesSlave = new double[slaveSize];
-        for (size_t i = 0; i < vertexDistribution[rankSlave].size(); i++) {
-          for (int j = 0; j < valueDimension; j++) {
-            valuesSlave[i * valueDimension + j] = globalItemsToReceive[vertexDistribution[rankSlave][i] * valueDimension + j];
-          }
+    std::vector<com::PtrRequest> sendRequests;
+    auto                         scatter = [&](int rank) {
+      std::vector<int> const &vertices = vertexDistribution[rank];
+      int                     rankSize = vertices.size() * valueDimension;
+      DEBUG("Rank " << rank << " Size = " << rankSize);
+      double *values = itemsToReceive;
+      if (rank != 0) {
+        _slaveBuffers[rank].resize(rankSize);
+        values = _slaveBuffers[rank].data();
+      }
+      for (size_t i = 0; i < vertices.size(); i++) {
+        for (int j = 0; j < valueDimension; j++) {
+          values[i * valueDimension + j] = _globalBuffer[vertices[i] * valueDimension + j];
+        }
+      }
+      if (rank != 0) {
+        sendRequests.push_back(utils::MasterSlave::_communication->aSend(values, rankSize, rank));
+      }
+    };
+
+    //receive chunks from other master in order, scattering while the next uncompressed chunk arrives
+    auto aReceiveChunk = [&](int chunk) {
+      auto range = chunkRange(chunk, globalVertexCount, valueDimension);
+      return _com->aReceive(&_globalBuffer[range.first], range.second - range.first, 0);
+    };
+
+    com::PtrRequest request;
+    if (chunks > 0 && not compressor) {
+      request = aReceiveChunk(0);
+    }
+    for (int chunk = 0; chunk < chunks; chunk++) {
+      if (compressor) {
+        auto range = chunkRange(chunk, globalVertexCount, valueDimension);
+        receiveChunk(*_com, &_globalBuffer[range.first], range.second - range.first,
+                     chunk, compressor, _encoded);
+      } else {
+        request->wait();
+        if (chunk + 1 < chunks) {
+          request = aReceiveChunk(chunk + 1);
         }
-        utils::MasterSlave::_communication->send(valuesSlave, slaveSize, rankSlave);
-        DEBUG("valuesSlave[0] = " << valuesSlave[0]);
-        delete[] valuesSlave;
+      }
+      for (int rank : completeRanks[chunk]) {
+        scatter(rank);
       }
     }
-    delete[] globalItemsToReceive;
+
+    com::Request::wait(sendRequests);
   } //master
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <vector>
 #include "DistributedCommunication.hpp"
 #include "com/SharedPointer.hpp"
 #include "logging/Logger.hpp"
@@ -13,6 +14,12 @@ namespace m2n
  * @brief Implements DistributedCommunication by using a gathering/scattering methodology.
  * Arrays of data are always gathered and scattered at the master. No direct communication
  * between slaves is used.
+ *
+ * The master receives from all slaves at once and merges their values in completion order.
+ * The values of the whole mesh are exchanged between the masters as a stream of chunks of
+ * CHUNK_VERTICES vertices each, such that the transfer to the remote master overlaps with
+ * gathering and scattering. If a compressor is given, each chunk is compressed on the
+ * channel of its index.
  * For more details see m2n/DistributedCommunication.hpp
  */
 class GatherScatterCommunication : public DistributedCommunication
@@ -55,6 +62,28 @@ public:
       const std::string &nameAcceptor,
       const std::string &nameRequester);
 
+  /// Not supported, the mesh is always exchanged through the masters.
+  virtual void acceptPreConnection(
+      const std::string &     nameAcceptor,
+      const std::string &     nameRequester,
+      const std::vector<int> &remoteRanks);
+
+  /// Not supported, the mesh is always exchanged through the masters.
+  virtual void requestPreConnection(
+      const std::string &     nameAcceptor,
+      const std::string &     nameRequester,
+      const std::vector<int> &remoteRanks);
+
+  /// Not supported, the mesh is always exchanged through the masters.
+  virtual void sendMesh(
+      mesh::Mesh &mesh,
+      int         remoteRank);
+
+  /// Not supported, the mesh is always exchanged through the masters.
+  virtual void receiveMesh(
+      mesh::Mesh &mesh,
+      int         remoteRank);
+
   /**
    * @brief Disconnects from communication space, i.e. participant.
    *
@@ -62,17 +91,43 @@ public:
    */
   virtual void closeConnection();
 
+  /// Number of vertices, whose values are exchanged between the masters in a single message.
+  static const int CHUNK_VERTICES = 16384;
+
+  /**
+   * @brief Sends the values of a whole mesh in chunks to a remote master.
+   *
+   * Used by non-parallel participants, such that they can be coupled to parallel
+   * participants using gather-scatter communication.
+   */
+  static void sendChunks(
+      com::Communication &communication,
+      const double *      itemsToSend,
+      int                 size,
+      int                 valueDimension,
+      Compressor *        compressor = nullptr);
+
+  /// Receives the values of a whole mesh in chunks from a remote master, see sendChunks().
+  static void receiveChunks(
+      com::Communication &communication,
+      double *            itemsToReceive,
+      int                 size,
+      int                 valueDimension,
+      Compressor *        compressor = nullptr);
+
   /// Sends an array of double values from all slaves (different for each slave).
   virtual void send(
-      double *itemsToSend,
-      size_t  size,
-      int     valueDimension);
+      double *    itemsToSend,
+      size_t      size,
+      int         valueDimension,
+      Compressor *compressor = nullptr);
 
   /// All slaves receive an array of doubles (different for each slave).
   virtual void receive(
-      double *itemsToReceive,
-      size_t  size,
-      int     valueDimension);
+      double *    itemsToReceive,
+      size_t      size,
+      int         valueDimension,
+      Compressor *compressor = nullptr);
 
 private:
   logging::Logger _log{"m2n::GatherScatterCommunication"};
@@ -82,6 +137,15 @@ private:
 
   /// Global communication is set up or not
   bool _isConnected;
+
+  /// Values of each slave at the master, reused by all calls of send() and receive().
+  std::vector<std::vector<double>> _slaveBuffers;
+
+  /// Values of the whole mesh at the master, reused by all calls of send() and receive().
+  std::vector<double> _globalBuffer;
+
+  /// Encoded values of the chunk in flight to the remote master, if compressed.
+  std::vector<int> _encoded;
 };
 
 } // namespace m2n
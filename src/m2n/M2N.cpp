@@ -2,6 +2,7 @@
 #include "M2N.hpp"
 #include "DistributedComFactory.hpp"
 #include "DistributedCommunication.hpp"
+#include "GatherScatterCommunication.hpp"
 #include "com/Communication.hpp"
 #include "mesh/Mesh.hpp"
 #include "utils/EventTimings.hpp"
@@ -19,9 +20,10 @@ extern bool testMode;
 namespace m2n
 {
 
-M2N::M2N(com::PtrCommunication masterCom, DistributedComFactory::SharedPointer distrFactory)
+M2N::M2N(com::PtrCommunication masterCom, DistributedComFactory::SharedPointer distrFactory, bool useTwoLevelInit)
     : _masterCom(masterCom),
-      _distrFactory(distrFactory)
+      _distrFactory(distrFactory),
+      _useTwoLevelInit(useTwoLevelInit)
 {
 }
 
@@ -100,6 +102,47 @@ void M2N::requestSlavesConnection(
   assertion(_areSlavesConnected);
 }
 
+void M2N::acceptSlavesPreConnection(
+    const std::string &     nameAcceptor,
+    const std::string &     nameRequester,
+    int                     meshID,
+    const std::vector<int> &remoteRanks)
+{
+  TRACE(nameAcceptor, nameRequester, meshID);
+  assertion(_distComs.find(meshID) != _distComs.end());
+  _distComs[meshID]->acceptPreConnection(nameAcceptor, nameRequester, remoteRanks);
+}
+
+void M2N::requestSlavesPreConnection(
+    const std::string &     nameAcceptor,
+    const std::string &     nameRequester,
+    int                     meshID,
+    const std::vector<int> &remoteRanks)
+{
+  TRACE(nameAcceptor, nameRequester, meshID);
+  assertion(_distComs.find(meshID) != _distComs.end());
+  _distComs[meshID]->requestPreConnection(nameAcceptor, nameRequester, remoteRanks);
+}
+
+void M2N::closeSlavesPreConnection(int meshID)
+{
+  TRACE(meshID);
+  assertion(_distComs.find(meshID) != _distComs.end());
+  _distComs[meshID]->closeConnection();
+}
+
+void M2N::sendMesh(mesh::Mesh &mesh, int meshID, int remoteRank)
+{
+  assertion(_distComs.find(meshID) != _distComs.end());
+  _distComs[meshID]->sendMesh(mesh, remoteRank);
+}
+
+void M2N::receiveMesh(mesh::Mesh &mesh, int meshID, int remoteRank)
+{
+  assertion(_distComs.find(meshID) != _distComs.end());
+  _distComs[meshID]->receiveMesh(mesh, remoteRank);
+}
+
 void M2N::closeConnection()
 {
   TRACE();
@@ -133,10 +176,11 @@ void M2N::createDistributedCommunication(mesh::PtrMesh mesh)
 }
 
 void M2N::send(
-    double *itemsToSend,
-    int     size,
-    int     meshID,
-    int     valueDimension)
+    double *    itemsToSend,
+    int         size,
+    int         meshID,
+    int         valueDimension,
+    Compressor *compressor)
 {
   if (utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode) {
     assertion(_areSlavesConnected);
@@ -157,10 +201,10 @@ void M2N::send(
     }
 #endif
 
-    _distComs[meshID]->send(itemsToSend, size, valueDimension);
+    _distComs[meshID]->send(itemsToSend, size, valueDimension, compressor);
   } else { //coupling mode
     assertion(_isMasterConnected);
-    _masterCom->send(itemsToSend, size, 0);
+    GatherScatterCommunication::sendChunks(*_masterCom, itemsToSend, size, valueDimension, compressor);
   }
 }
 
@@ -180,10 +224,11 @@ void M2N::send(double itemToSend)
   }
 }
 
-void M2N::receive(double *itemsToReceive,
-                  int     size,
-                  int     meshID,
-                  int     valueDimension)
+void M2N::receive(double *    itemsToReceive,
+                  int         size,
+                  int         meshID,
+                  int         valueDimension,
+                  Compressor *compressor)
 {
   if (utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode) {
     assertion(_areSlavesConnected);
@@ -204,10 +249,10 @@ void M2N::receive(double *itemsToReceive,
     }
 #endif
 
-    _distComs[meshID]->receive(itemsToReceive, size, valueDimension);
+    _distComs[meshID]->receive(itemsToReceive, size, valueDimension, compressor);
   } else { //coupling mode
     assertion(_isMasterConnected);
-    _masterCom->receive(itemsToReceive, size, 0);
+    GatherScatterCommunication::receiveChunks(*_masterCom, itemsToReceive, size, valueDimension, compressor);
   }
 }
 
@@ -1,10 +1,13 @@
 #pragma once
 
 #include "DistributedComFactory.hpp"
+#include "SharedPointer.hpp"
 #include "com/SharedPointer.hpp"
 #include "logging/Logger.hpp"
 #include "mesh/SharedPointer.hpp"
 #include <map>
+#include <string>
+#include <vector>
 
 namespace precice
 {
@@ -20,7 +23,13 @@ namespace m2n
 class M2N
 {
 public:
-  M2N(com::PtrCommunication masterCom, DistributedComFactory::SharedPointer distrFactory);
+  /**
+   * @brief Constructor.
+   *
+   * If useTwoLevelInit is true, received meshes are exchanged directly between the ranks of
+   * both participants, see acceptSlavesPreConnection().
+   */
+  M2N(com::PtrCommunication masterCom, DistributedComFactory::SharedPointer distrFactory, bool useTwoLevelInit = false);
 
   /// Destructor, empty.
   ~M2N();
@@ -64,6 +73,38 @@ public:
   void requestSlavesConnection(const std::string &nameAcceptor,
                                const std::string &nameRequester);
 
+  /// Returns true, if meshes are exchanged directly between the ranks of both participants.
+  bool usesTwoLevelInitialization() const
+  {
+    return _useTwoLevelInit;
+  }
+
+  /**
+   * @brief Connects the ranks of this participant to the given ranks of the remote participant,
+   *        which has to call requestSlavesPreConnection(), to exchange a mesh before it is partitioned.
+   *
+   * The connection has to be closed by closeSlavesPreConnection() before the slaves connection is set up.
+   */
+  void acceptSlavesPreConnection(const std::string &     nameAcceptor,
+                                 const std::string &     nameRequester,
+                                 int                     meshID,
+                                 const std::vector<int> &remoteRanks);
+
+  /// Connects the ranks of this participant to the given remote ranks, see acceptSlavesPreConnection().
+  void requestSlavesPreConnection(const std::string &     nameAcceptor,
+                                  const std::string &     nameRequester,
+                                  int                     meshID,
+                                  const std::vector<int> &remoteRanks);
+
+  /// Closes the connection set up by acceptSlavesPreConnection() or requestSlavesPreConnection().
+  void closeSlavesPreConnection(int meshID);
+
+  /// Sends a mesh to a connected rank of the remote participant.
+  void sendMesh(mesh::Mesh &mesh, int meshID, int remoteRank);
+
+  /// Receives a mesh from a connected rank of the remote participant and adds it to the given mesh.
+  void receiveMesh(mesh::Mesh &mesh, int meshID, int remoteRank);
+
   /**
    * @brief Disconnects from communication space, i.e. participant.
    *
@@ -77,11 +118,12 @@ public:
   /// Creates a new distributes communication for that mesh, stores the pointer in _distComs
   void createDistributedCommunication(mesh::PtrMesh mesh);
 
-  /// Sends an array of double values from all slaves (different for each slave).
-  void send(double *itemsToSend,
-            int     size,
-            int     meshID,
-            int     valueDimension);
+  /// Sends an array of double values from all slaves (different for each slave), compressed if a compressor is given.
+  void send(double *    itemsToSend,
+            int         size,
+            int         meshID,
+            int         valueDimension,
+            Compressor *compressor = nullptr);
 
   /**
    * @brief The master sends a bool to the other master, for performance reasons, we
@@ -95,11 +137,12 @@ public:
    */
   void send(double itemToSend);
 
-  /// All slaves receive an array of doubles (different for each slave).
-  void receive(double *itemsToReceive,
-               int     size,
-               int     meshID,
-               int     valueDimension);
+  /// All slaves receive an array of doubles (different for each slave), decompressed if a compressor is given.
+  void receive(double *    itemsToReceive,
+               int         size,
+               int         meshID,
+               int         valueDimension,
+               Compressor *compressor = nullptr);
 
   /// All slaves receive a bool (the same for each slave).
   void receive(bool &itemToReceive);
@@ -120,6 +163,8 @@ private:
   bool _isMasterConnected = false;
 
   bool _areSlavesConnected = false;
+
+  bool _useTwoLevelInit = false;
 };
 
 } // namespace m2n
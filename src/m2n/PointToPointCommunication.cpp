@@ -1,6 +1,11 @@
 #include "PointToPointCommunication.hpp"
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
 #include <vector>
+#include "Compressor.hpp"
 #include "com/Communication.hpp"
+#include "com/CommunicateMesh.hpp"
 #include "com/CommunicationFactory.hpp"
 #include "mesh/Mesh.hpp"
 #include "utils/EventTimings.hpp"
@@ -44,43 +49,110 @@ void receive(mesh::Mesh::VertexDistribution &m,
   }
 }
 
-void broadcastSend(mesh::Mesh::VertexDistribution const &m,
-                   com::PtrCommunication                  communication = utils::MasterSlave::_communication)
+/**
+ * @brief Restricts a remote vertex distribution to the vertices of each local rank.
+ *
+ * For each process rank in `thisVertexDistribution', the returned map holds the
+ * part of `otherVertexDistribution' with those data indices, which the
+ * process rank holds as well. The complexity is O((total number of data indices
+ * in `thisVertexDistribution') + (total number of data indices in
+ * `otherVertexDistribution')).
+ */
+std::map<int, mesh::Mesh::VertexDistribution> filterVertexDistribution(
+    mesh::Mesh::VertexDistribution const &thisVertexDistribution,
+    mesh::Mesh::VertexDistribution const &otherVertexDistribution)
 {
-  communication->broadcast(static_cast<int>(m.size()));
+  int maxIndex = -1;
 
-  for (auto const &i : m) {
-    auto const &rank    = i.first;
-    auto const &indices = i.second;
-    communication->broadcast(rank);
-    communication->broadcast(indices);
+  for (auto const &i : thisVertexDistribution) {
+    for (int index : i.second) {
+      maxIndex = std::max(maxIndex, index);
+    }
   }
-}
 
-void broadcastReceive(mesh::Mesh::VertexDistribution &m,
-                      int                              rankBroadcaster,
-                      com::PtrCommunication            communication = utils::MasterSlave::_communication)
-{
-  m.clear();
-  int size = 0;
-  communication->broadcast(size, rankBroadcaster);
+  // Process ranks holding each data index, stored in compressed rows.
+  std::vector<int> offsets(maxIndex + 2, 0);
 
-  while (size--) {
-    int rank = -1;
-    communication->broadcast(rank, rankBroadcaster);
-    communication->broadcast(m[rank], rankBroadcaster);
+  for (auto const &i : thisVertexDistribution) {
+    for (int index : i.second) {
+      offsets[index + 1]++;
+    }
+  }
+
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+  std::vector<int> ranks(offsets.back());
+  std::vector<int> positions(offsets.begin(), offsets.end() - 1);
+
+  for (auto const &i : thisVertexDistribution) {
+    for (int index : i.second) {
+      ranks[positions[index]++] = i.first;
+    }
+  }
+
+  std::map<int, mesh::Mesh::VertexDistribution> filtered;
+
+  for (auto const &other : otherVertexDistribution) {
+    for (int otherIndex : other.second) {
+      if (otherIndex < 0 || otherIndex > maxIndex)
+        continue;
+
+      for (int k = offsets[otherIndex]; k < offsets[otherIndex + 1]; ++k) {
+        filtered[ranks[k]][other.first].push_back(otherIndex);
+      }
+    }
   }
+
+  return filtered;
 }
 
-void broadcast(mesh::Mesh::VertexDistribution &m)
+/**
+ * @brief Provides each rank with the parts of both vertex distributions it needs.
+ *
+ * The master filters the remote vertex distribution for each rank and sends
+ * each slave only its own data indices and the matching part of the remote
+ * vertex distribution. Hence, the memory of the slaves scales with their local
+ * partition, not with the global mesh.
+ *
+ * @param[in] thisVertexDistribution Vertex distribution of this participant (master only).
+ * @param[in] otherVertexDistribution Vertex distribution of the remote participant (master only).
+ * @param[out] localVertexDistribution Data indices of the current rank.
+ * @param[out] localOtherVertexDistribution Part of the remote vertex distribution
+ *             matching the data indices of the current rank.
+ */
+void scatter(mesh::Mesh::VertexDistribution const &thisVertexDistribution,
+             mesh::Mesh::VertexDistribution const &otherVertexDistribution,
+             mesh::Mesh::VertexDistribution &      localVertexDistribution,
+             mesh::Mesh::VertexDistribution &      localOtherVertexDistribution)
 {
+  localVertexDistribution.clear();
+  localOtherVertexDistribution.clear();
+
   if (utils::MasterSlave::_masterMode) {
-    // Broadcast (send) vertex distributions.
-    m2n::broadcastSend(m);
+    auto filtered = filterVertexDistribution(thisVertexDistribution, otherVertexDistribution);
+
+    for (int rank = 0; rank < utils::MasterSlave::_size; ++rank) {
+      mesh::Mesh::VertexDistribution rankVertexDistribution;
+
+      auto iterator = thisVertexDistribution.find(rank);
+
+      if (iterator != thisVertexDistribution.end())
+        rankVertexDistribution[rank] = iterator->second;
+
+      if (rank == 0) {
+        localVertexDistribution      = std::move(rankVertexDistribution);
+        localOtherVertexDistribution = std::move(filtered[rank]);
+      } else {
+        m2n::send(rankVertexDistribution, rank, utils::MasterSlave::_communication);
+        m2n::send(filtered[rank], rank, utils::MasterSlave::_communication);
+      }
+
+      filtered.erase(rank);
+    }
   } else {
     assertion(utils::MasterSlave::_slaveMode);
-    // Broadcast (receive) vertex distributions.
-    m2n::broadcastReceive(m, 0);
+    m2n::receive(localVertexDistribution, 0, utils::MasterSlave::_communication);
+    m2n::receive(localOtherVertexDistribution, 0, utils::MasterSlave::_communication);
   }
 }
 
@@ -216,17 +288,14 @@ void printLocalIndexCountStats(std::map<int, std::vector<int>> const &m)
   }
 }
 
-// The approximate complexity of this function is O((number of local data
-// indices for the current rank in `thisVertexDistribution') * (total number of
-// data indices for all ranks in `otherVertexDistribution')).
+// The complexity of this function is O((number of local data indices for the
+// current rank in `thisVertexDistribution') + (total number of data indices for
+// all ranks in `otherVertexDistribution')).
 std::map<int, std::vector<int>> buildCommunicationMap(
-    // `localIndexCount' is the number of unique local indices for the current rank.
-    size_t &localIndexCount,
-    // `thisVertexDistribution' is input vertex distribution from this participant.
+    size_t &                              localIndexCount,
     mesh::Mesh::VertexDistribution const &thisVertexDistribution,
-    // `otherVertexDistribution' is input vertex distribution from other participant.
     mesh::Mesh::VertexDistribution const &otherVertexDistribution,
-    int                                    thisRank = utils::MasterSlave::_rank)
+    int                                   thisRank)
 {
 
   localIndexCount = 0;
@@ -235,23 +304,67 @@ std::map<int, std::vector<int>> buildCommunicationMap(
 
   auto iterator = thisVertexDistribution.find(thisRank);
 
-  if (iterator == thisVertexDistribution.end())
+  if (iterator == thisVertexDistribution.end() || iterator->second.empty())
     return communicationMap;
 
   auto const &indices = iterator->second;
 
-  int index = 0;
+  // Lookup from a global data index to a slot, which is shared by all local
+  // data indices with the same value. If the local data indices lie in a
+  // dense range, a direct lookup array is used, otherwise a hash map.
+  auto minmax   = std::minmax_element(indices.begin(), indices.end());
+  int  minIndex = *minmax.first;
+  long range    = static_cast<long>(*minmax.second) - minIndex + 1;
+  bool isDense  = range <= 4 * static_cast<long>(indices.size());
+
+  std::vector<int>             slotArray;
+  std::unordered_map<int, int> slotMap;
+  std::vector<int>             slots;
+  slots.reserve(indices.size());
+
+  if (isDense) {
+    slotArray.assign(range, -1);
+  } else {
+    slotMap.reserve(indices.size());
+  }
+
+  int slotCount = 0;
 
   for (int thisIndex : indices) {
-    for (const auto &other : otherVertexDistribution) {
-      for (const auto &otherIndex : other.second) {
-        if (thisIndex == otherIndex) {
-          communicationMap[other.first].push_back(index);
-          break;
-        }
-      }
+    int &slot = isDense ? slotArray[thisIndex - minIndex] : slotMap.emplace(thisIndex, -1).first->second;
+
+    if (slot == -1)
+      slot = slotCount++;
+
+    slots.push_back(slot);
+  }
+
+  auto findSlot = [&](int otherIndex) {
+    if (isDense) {
+      long offset = static_cast<long>(otherIndex) - minIndex;
+      return (offset >= 0 && offset < range) ? slotArray[offset] : -1;
+    }
+    auto found = slotMap.find(otherIndex);
+    return found != slotMap.end() ? found->second : -1;
+  };
+
+  // Remote ranks holding the global data index of each slot, in ascending
+  // order and without duplicates.
+  std::vector<std::vector<int>> remoteRanks(slotCount);
+
+  for (auto const &other : otherVertexDistribution) {
+    for (int otherIndex : other.second) {
+      int slot = findSlot(otherIndex);
+
+      if (slot != -1 && (remoteRanks[slot].empty() || remoteRanks[slot].back() != other.first))
+        remoteRanks[slot].push_back(other.first);
+    }
+  }
+
+  for (size_t index = 0; index < indices.size(); ++index) {
+    for (int otherRank : remoteRanks[slots[index]]) {
+      communicationMap[otherRank].push_back(index);
     }
-    ++index;
   }
 
   // CAUTION:
@@ -342,8 +455,13 @@ void PointToPointCommunication::acceptConnection(std::string const &nameAcceptor
     assertion(utils::MasterSlave::_slaveMode);
   }
 
-  m2n::broadcast(vertexDistribution);
-  m2n::broadcast(requesterVertexDistribution);
+  // Vertex distributions of both participants, restricted to the data indices
+  // of the current process rank.
+  mesh::Mesh::VertexDistribution localVertexDistribution;
+  mesh::Mesh::VertexDistribution localRequesterVertexDistribution;
+
+  m2n::scatter(vertexDistribution, requesterVertexDistribution,
+               localVertexDistribution, localRequesterVertexDistribution);
 
   // Local (for process rank in the current participant) communication map that
   // defines a mapping from a process rank in the remote participant to an array
@@ -363,7 +481,7 @@ void PointToPointCommunication::acceptConnection(std::string const &nameAcceptor
   // - has to communicate (send/receive) data with local indices 0 and 2 with
   //   the remote process with rank 4.
   std::map<int, std::vector<int>> communicationMap = m2n::buildCommunicationMap(
-      _localIndexCount, vertexDistribution, requesterVertexDistribution);
+      _localIndexCount, localVertexDistribution, localRequesterVertexDistribution);
 
 // Print `communicationMap'.
 #ifdef P2P_LCM_PRINT
@@ -397,54 +515,7 @@ void PointToPointCommunication::acceptConnection(std::string const &nameAcceptor
   }
 #endif
 
-  if (communicationMap.empty()) {
-    assertion(_localIndexCount == 0);
-    _isConnected = true;
-    return;
-  }
-
-  // Accept point-to-point connections (as server) between the current acceptor
-  // process (in the current participant) with rank `utils::MasterSlave::_rank'
-  // and (multiple) requester processes (in the requester participant).
-  auto c = _communicationFactory->newCommunication();
-
-#ifdef SuperMUC_WORK
-  Publisher::ScopedPushDirectory spd("." + nameAcceptor + "-" + _mesh->getName() + "-" +
-                                     std::to_string(utils::MasterSlave::_rank) + ".address");
-#endif
-
-  c->acceptConnectionAsServer(
-      nameAcceptor + "-" + std::to_string(utils::MasterSlave::_rank),
-      nameRequester,
-      communicationMap.size());
-
-  // assertion(c->getRemoteCommunicatorSize() == communicationMap.size());
-
-  _mappings.reserve(communicationMap.size());
-
-  for (size_t localRequesterRank = 0; localRequesterRank < communicationMap.size(); ++localRequesterRank) {
-    int globalRequesterRank = -1;
-
-    c->receive(globalRequesterRank, localRequesterRank);
-
-    auto indices = std::move(communicationMap[globalRequesterRank]);
-    _totalIndexCount += indices.size();
-
-    // NOTE:
-    // Everything is moved (efficiency)!
-    // On the acceptor participant side, the communication object `c'
-    // behaves as a server, i.e. it implicitly accepts multiple connections
-    // to requester processes (in the requester participant). As a result,
-    // only one communication object `c' is needed to satisfy
-    // `communicationMap', and, therefore, for data structure consistency
-    // of `_mappings' with the requester participant side, we simply
-    // duplicate references to the same communication object `c'.
-    _mappings.push_back({
-        static_cast<int>(localRequesterRank), globalRequesterRank, std::move(indices), c, com::PtrRequest(), 0});
-  }
-
-  _buffer.reserve(_totalIndexCount * _mesh->getDimensions());
-  _isConnected = true;
+  acceptRemoteRanks(nameAcceptor, nameRequester, communicationMap);
 }
 
 void PointToPointCommunication::requestConnection(std::string const &nameAcceptor,
@@ -482,8 +553,13 @@ void PointToPointCommunication::requestConnection(std::string const &nameAccepto
     assertion(utils::MasterSlave::_slaveMode);
   }
 
-  m2n::broadcast(vertexDistribution);
-  m2n::broadcast(acceptorVertexDistribution);
+  // Vertex distributions of both participants, restricted to the data indices
+  // of the current process rank.
+  mesh::Mesh::VertexDistribution localVertexDistribution;
+  mesh::Mesh::VertexDistribution localAcceptorVertexDistribution;
+
+  m2n::scatter(vertexDistribution, acceptorVertexDistribution,
+               localVertexDistribution, localAcceptorVertexDistribution);
 
   // Local (for process rank in the current participant) communication map that
   // defines a mapping from a process rank in the remote participant to an array
@@ -503,7 +579,7 @@ void PointToPointCommunication::requestConnection(std::string const &nameAccepto
   // - has to communicate (send/receive) data with local indices 0 and 2 with
   //   the remote process with rank 4.
   std::map<int, std::vector<int>> communicationMap = m2n::buildCommunicationMap(
-      _localIndexCount, vertexDistribution, acceptorVertexDistribution);
+      _localIndexCount, localVertexDistribution, localAcceptorVertexDistribution);
 
 // Print `communicationMap'.
 #ifdef P2P_LCM_PRINT
@@ -529,54 +605,51 @@ void PointToPointCommunication::requestConnection(std::string const &nameAccepto
   }
 #endif
 
-  if (communicationMap.empty()) {
-    assertion(_localIndexCount == 0);
-    _isConnected = true;
-    return;
-  }
-
-  Publisher::ScopedSetEventNamePrefix ssenp(_prefix + "PointToPointCommunication::requestConnection/request/");
-
-  std::vector<com::PtrRequest> requests;
-  requests.reserve(communicationMap.size());
-  _mappings.reserve(communicationMap.size());
-
-  // Request point-to-point connections (as client) between the current
-  // requester process (in the current participant) and (multiple) acceptor
-  // processes (in the acceptor participant) with ranks `globalAcceptorRank'
-  // according to communication map.
-  for (auto &i : communicationMap) {
-    auto globalAcceptorRank = i.first;
-    auto indices            = std::move(i.second);
-
-    _totalIndexCount += indices.size();
-
-    auto c = _communicationFactory->newCommunication();
-
-#ifdef SuperMUC_WORK
-    Publisher::ScopedPushDirectory spd("." + nameAcceptor + "-" + _mesh->getName() + "-" +
-                                       std::to_string(globalAcceptorRank) + ".address");
-#endif
+  requestRemoteRanks(nameAcceptor, nameRequester, communicationMap);
+}
 
-    c->requestConnectionAsClient(nameAcceptor + "-" + std::to_string(globalAcceptorRank), nameRequester);
-    // assertion(c->getRemoteCommunicatorSize() == 1);
+void PointToPointCommunication::acceptPreConnection(std::string const &     nameAcceptor,
+                                                    std::string const &     nameRequester,
+                                                    std::vector<int> const &remoteRanks)
+{
+  TRACE(nameAcceptor, nameRequester, remoteRanks.size());
+  CHECK(not isConnected(), "Already connected!");
 
-    auto request = c->aSend(utils::MasterSlave::_rank, 0);
+  std::map<int, std::vector<int>> communicationMap;
+  for (int remoteRank : remoteRanks) {
+    communicationMap[remoteRank];
+  }
+  _localIndexCount = 0;
+  acceptRemoteRanks(nameAcceptor, nameRequester, communicationMap);
+}
 
-    requests.push_back(request);
+void PointToPointCommunication::requestPreConnection(std::string const &     nameAcceptor,
+                                                     std::string const &     nameRequester,
+                                                     std::vector<int> const &remoteRanks)
+{
+  TRACE(nameAcceptor, nameRequester, remoteRanks.size());
+  CHECK(not isConnected(), "Already connected!");
 
-    // NOTE:
-    // Everything is moved (efficiency)!
-    // On the requester participant side, the communication objects behave
-    // as clients, i.e. each of them requests only one connection to
-    // acceptor process (in the acceptor participant).
-    _mappings.push_back({
-        0, globalAcceptorRank, std::move(indices), c, com::PtrRequest(), 0});
+  std::map<int, std::vector<int>> communicationMap;
+  for (int remoteRank : remoteRanks) {
+    communicationMap[remoteRank];
   }
+  _localIndexCount = 0;
+  requestRemoteRanks(nameAcceptor, nameRequester, communicationMap);
+}
 
-  com::Request::wait(requests);
-  _buffer.reserve(_totalIndexCount * _mesh->getDimensions());
-  _isConnected = true;
+void PointToPointCommunication::sendMesh(mesh::Mesh &mesh, int remoteRank)
+{
+  TRACE(remoteRank);
+  Mapping &mapping = findMapping(remoteRank);
+  com::CommunicateMesh(mapping.communication).sendMesh(mesh, mapping.localRemoteRank);
+}
+
+void PointToPointCommunication::receiveMesh(mesh::Mesh &mesh, int remoteRank)
+{
+  TRACE(remoteRank);
+  Mapping &mapping = findMapping(remoteRank);
+  com::CommunicateMesh(mapping.communication).receiveMesh(mesh, mapping.localRemoteRank);
 }
 
 void PointToPointCommunication::closeConnection()
@@ -587,19 +660,22 @@ void PointToPointCommunication::closeConnection()
     return;
 
   for (auto &mapping : _mappings) {
+    // Persistent requests have to be freed before the connection is closed.
+    mapping.sendRequests.clear();
+    mapping.receiveRequests.clear();
     mapping.communication->closeConnection();
   }
 
   _mappings.clear();
-  _buffer.clear();
   _localIndexCount = 0;
   _totalIndexCount = 0;
   _isConnected     = false;
 }
 
-void PointToPointCommunication::send(double *itemsToSend,
-                                     size_t  size,
-                                     int     valueDimension)
+void PointToPointCommunication::send(double *    itemsToSend,
+                                     size_t      size,
+                                     int         valueDimension,
+                                     Compressor *compressor)
 {
 
   if (_mappings.size() == 0) {
@@ -608,64 +684,398 @@ void PointToPointCommunication::send(double *itemsToSend,
   }
 
   assertion(size == _localIndexCount * valueDimension, size, _localIndexCount * valueDimension);
+  assertion(valueDimension <= _mesh->getDimensions(), valueDimension, _mesh->getDimensions());
+
+  if (compressor) {
+    sendCompressed(itemsToSend, valueDimension, *compressor);
+    return;
+  }
+
+  std::vector<com::PtrRequest> requests;
+  std::vector<com::PtrRequest> persistentRequests;
+  requests.reserve(_mappings.size());
+  persistentRequests.reserve(_mappings.size());
 
   for (auto &mapping : _mappings) {
-    mapping.offset = _buffer.size();
+    if (mapping.runs.size() == 1) {
+      auto const &run = mapping.runs.front();
 
-    for (auto index : mapping.indices) {
-      for (int d = 0; d < valueDimension; ++d) {
-        _buffer.push_back(itemsToSend[index * valueDimension + d]);
-      }
+      requests.push_back(mapping.communication->aSend(itemsToSend + run.first * valueDimension,
+                                                      run.second * valueDimension,
+                                                      mapping.localRemoteRank));
+      continue;
+    }
+
+    double *target = mapping.buffer.data();
+
+    for (auto const &run : mapping.runs) {
+      target = std::copy(itemsToSend + run.first * valueDimension,
+                         itemsToSend + (run.first + run.second) * valueDimension,
+                         target);
     }
 
-    mapping.request = mapping.communication->aSend(_buffer.data() + mapping.offset,
+    auto &request = mapping.sendRequests[valueDimension];
+
+    if (not request) {
+      request = mapping.communication->sendInit(mapping.buffer.data(),
+                                                mapping.indices.size() * valueDimension,
+                                                mapping.localRemoteRank);
+    }
+
+    requests.push_back(request);
+    persistentRequests.push_back(request);
+  }
+
+  com::Request::start(persistentRequests);
+  com::Request::wait(requests);
+}
+
+void PointToPointCommunication::receive(double *    itemsToReceive,
+                                        size_t      size,
+                                        int         valueDimension,
+                                        Compressor *compressor)
+{
+  if (_mappings.size() == 0) {
+    assertion(_localIndexCount == 0);
+    return;
+  }
+  assertion(size == _localIndexCount * valueDimension, size, _localIndexCount * valueDimension);
+  assertion(valueDimension <= _mesh->getDimensions(), valueDimension, _mesh->getDimensions());
+
+  std::fill(itemsToReceive, itemsToReceive + size, 0);
+
+  if (compressor) {
+    receiveCompressed(itemsToReceive, valueDimension, *compressor);
+    return;
+  }
+
+  std::vector<com::PtrRequest> requests;
+  std::vector<com::PtrRequest> persistentRequests;
+  requests.reserve(_mappings.size());
+  persistentRequests.reserve(_mappings.size());
+
+  for (auto &mapping : _mappings) {
+    if (mapping.receivesDirectly()) {
+      auto const &run = mapping.runs.front();
+
+      requests.push_back(mapping.communication->aReceive(itemsToReceive + run.first * valueDimension,
+                                                         run.second * valueDimension,
+                                                         mapping.localRemoteRank));
+      continue;
+    }
+
+    auto &request = mapping.receiveRequests[valueDimension];
+
+    if (not request) {
+      request = mapping.communication->receiveInit(mapping.buffer.data(),
                                                    mapping.indices.size() * valueDimension,
                                                    mapping.localRemoteRank);
+    }
+
+    requests.push_back(request);
+    persistentRequests.push_back(request);
+  }
+
+  com::Request::start(persistentRequests);
+
+  // Unpack the data of each partner as soon as it has arrived, such that the
+  // unpacking overlaps with the communication of the remaining partners.
+  int completed = -1;
+
+  while ((completed = com::Request::waitAny(requests)) != -1) {
+    auto const &mapping = _mappings[completed];
+
+    if (mapping.receivesDirectly())
+      continue;
+
+    double const *source = mapping.buffer.data();
+
+    for (auto const &run : mapping.runs) {
+      double *target = itemsToReceive + run.first * valueDimension;
+
+      for (int i = 0; i < run.second * valueDimension; ++i) {
+        target[i] += *source++;
+      }
+    }
   }
+}
+
+void PointToPointCommunication::sendCompressed(double *    itemsToSend,
+                                               int         valueDimension,
+                                               Compressor &compressor)
+{
+  std::vector<com::PtrRequest> requests;
+  requests.reserve(2 * _mappings.size());
 
   for (auto &mapping : _mappings) {
-    mapping.request->wait();
+    const double *values = itemsToSend + mapping.runs.front().first * valueDimension;
+
+    if (mapping.runs.size() > 1) {
+      double *target = mapping.buffer.data();
+
+      for (auto const &run : mapping.runs) {
+        target = std::copy(itemsToSend + run.first * valueDimension,
+                           itemsToSend + (run.first + run.second) * valueDimension,
+                           target);
+      }
+      values = mapping.buffer.data();
+    }
+
+    compressor.compress(mapping.globalRemoteRank, values, mapping.indices.size() * valueDimension, mapping.encoded);
+
+    // The size is sent from the mapping, since it has to outlive the asynchronous send.
+    mapping.encodedSize = static_cast<int>(mapping.encoded.size());
+    requests.push_back(mapping.communication->aSend(&mapping.encodedSize, 1, mapping.localRemoteRank));
+    requests.push_back(mapping.communication->aSend(mapping.encoded.data(),
+                                                    mapping.encoded.size(),
+                                                    mapping.localRemoteRank));
   }
-  _buffer.clear();
+
+  com::Request::wait(requests);
 }
 
-void PointToPointCommunication::receive(double *itemsToReceive,
-                                        size_t  size,
-                                        int     valueDimension)
+void PointToPointCommunication::receiveCompressed(double *    itemsToReceive,
+                                                  int         valueDimension,
+                                                  Compressor &compressor)
 {
-  if (_mappings.size() == 0) {
+  std::vector<com::PtrRequest> requests;
+  requests.reserve(_mappings.size());
+
+  for (auto &mapping : _mappings) {
+    requests.push_back(mapping.communication->aReceive(mapping.encodedSize, mapping.localRemoteRank));
+  }
+
+  com::Request::wait(requests);
+  requests.clear();
+
+  for (auto &mapping : _mappings) {
+    mapping.encoded.resize(mapping.encodedSize);
+    requests.push_back(mapping.communication->aReceive(mapping.encoded.data(),
+                                                       mapping.encodedSize,
+                                                       mapping.localRemoteRank));
+  }
+
+  // Decode the data of each partner as soon as it has arrived.
+  int completed = -1;
+
+  while ((completed = com::Request::waitAny(requests)) != -1) {
+    auto &mapping = _mappings[completed];
+    int   count   = mapping.indices.size() * valueDimension;
+
+    if (mapping.receivesDirectly()) {
+      compressor.decompress(mapping.globalRemoteRank, mapping.encoded,
+                            itemsToReceive + mapping.runs.front().first * valueDimension, count);
+      continue;
+    }
+
+    compressor.decompress(mapping.globalRemoteRank, mapping.encoded, mapping.buffer.data(), count);
+
+    double const *source = mapping.buffer.data();
+
+    for (auto const &run : mapping.runs) {
+      double *target = itemsToReceive + run.first * valueDimension;
+
+      for (int i = 0; i < run.second * valueDimension; ++i) {
+        target[i] += *source++;
+      }
+    }
+  }
+}
+
+void PointToPointCommunication::acceptRemoteRanks(std::string const &              nameAcceptor,
+                                                  std::string const &              nameRequester,
+                                                  std::map<int, std::vector<int>> &communicationMap)
+{
+  if (communicationMap.empty()) {
     assertion(_localIndexCount == 0);
+    _isConnected = true;
     return;
   }
-  assertion(size == _localIndexCount * valueDimension, size, _localIndexCount * valueDimension);
 
-  std::fill(itemsToReceive, itemsToReceive + size, 0);
+  // Accept point-to-point connections (as server) between the current acceptor
+  // process (in the current participant) with rank `utils::MasterSlave::_rank'
+  // and (multiple) requester processes (in the requester participant).
+  auto c = _communicationFactory->newCommunication();
+
+#ifdef SuperMUC_WORK
+  Publisher::ScopedPushDirectory spd("." + nameAcceptor + "-" + _mesh->getName() + "-" +
+                                     std::to_string(utils::MasterSlave::_rank) + ".address");
+#endif
+
+  c->acceptConnectionAsServer(
+      nameAcceptor + "-" + std::to_string(utils::MasterSlave::_rank),
+      nameRequester,
+      communicationMap.size());
+
+  // assertion(c->getRemoteCommunicatorSize() == communicationMap.size());
+
+  _mappings.reserve(communicationMap.size());
+
+  // Receive the global ranks of all requester processes at once.
+  std::vector<int>             globalRequesterRanks(communicationMap.size(), -1);
+  std::vector<com::PtrRequest> requests;
+
+  for (size_t localRequesterRank = 0; localRequesterRank < communicationMap.size(); ++localRequesterRank) {
+    requests.push_back(c->aReceive(globalRequesterRanks[localRequesterRank], localRequesterRank));
+  }
+
+  com::Request::wait(requests);
+
+  for (size_t localRequesterRank = 0; localRequesterRank < communicationMap.size(); ++localRequesterRank) {
+    int globalRequesterRank = globalRequesterRanks[localRequesterRank];
+
+    auto indices = std::move(communicationMap[globalRequesterRank]);
+    _totalIndexCount += indices.size();
+
+    // NOTE:
+    // Everything is moved (efficiency)!
+    // On the acceptor participant side, the communication object `c'
+    // behaves as a server, i.e. it implicitly accepts multiple connections
+    // to requester processes (in the requester participant). As a result,
+    // only one communication object `c' is needed to satisfy
+    // `communicationMap', and, therefore, for data structure consistency
+    // of `_mappings' with the requester participant side, we simply
+    // duplicate references to the same communication object `c'.
+    _mappings.push_back({
+        static_cast<int>(localRequesterRank), globalRequesterRank, std::move(indices), c, {}, {}, {}, {}, false, {}, 0});
+  }
+
+  setupMappings();
+  _isConnected = true;
+}
+
+void PointToPointCommunication::requestRemoteRanks(std::string const &              nameAcceptor,
+                                                   std::string const &              nameRequester,
+                                                   std::map<int, std::vector<int>> &communicationMap)
+{
+  if (communicationMap.empty()) {
+    assertion(_localIndexCount == 0);
+    _isConnected = true;
+    return;
+  }
+
+  Publisher::ScopedSetEventNamePrefix ssenp(_prefix + "PointToPointCommunication::requestConnection/request/");
+
+  _mappings.reserve(communicationMap.size());
+
+  // Request point-to-point connections (as client) between the current
+  // requester process (in the current participant) and (multiple) acceptor
+  // processes (in the acceptor participant) with ranks `globalAcceptorRank'
+  // according to communication map.
+  for (auto &i : communicationMap) {
+    auto globalAcceptorRank = i.first;
+    auto indices            = std::move(i.second);
+
+    _totalIndexCount += indices.size();
+
+    // NOTE:
+    // Everything is moved (efficiency)!
+    // On the requester participant side, the communication objects behave
+    // as clients, i.e. each of them requests only one connection to
+    // acceptor process (in the acceptor participant).
+    _mappings.push_back({
+        0, globalAcceptorRank, std::move(indices), _communicationFactory->newCommunication(), {}, {}, {}, {}, false, {}, 0});
+  }
+
+  // Wait for the addresses of all acceptor processes at once, instead of
+  // polling for each of them in turn.
+  {
+    std::vector<std::string> addressFilePaths;
+
+    for (auto &mapping : _mappings) {
+#ifdef SuperMUC_WORK
+      Publisher::ScopedPushDirectory spd("." + nameAcceptor + "-" + _mesh->getName() + "-" +
+                                         std::to_string(mapping.globalRemoteRank) + ".address");
+#endif
+
+      auto addressFilePath = mapping.communication->addressFilePath(
+          nameAcceptor + "-" + std::to_string(mapping.globalRemoteRank), nameRequester);
+
+      if (not addressFilePath.empty())
+        addressFilePaths.push_back(addressFilePath);
+    }
+
+    Publisher::waitForFiles(addressFilePaths);
+  }
+
+  std::vector<com::PtrRequest> requests;
+  requests.reserve(_mappings.size());
+
+  // Connect to all acceptor processes concurrently, where supported by the
+  // communication. Each requester process starts with a different acceptor
+  // process, such that blocking connections do not queue up at the same
+  // acceptor processes.
+  for (size_t k = 0; k < _mappings.size(); ++k) {
+    auto &mapping = _mappings[(k + utils::MasterSlave::_rank) % _mappings.size()];
+
+#ifdef SuperMUC_WORK
+    Publisher::ScopedPushDirectory spd("." + nameAcceptor + "-" + _mesh->getName() + "-" +
+                                       std::to_string(mapping.globalRemoteRank) + ".address");
+#endif
+
+    requests.push_back(mapping.communication->aRequestConnectionAsClient(
+        nameAcceptor + "-" + std::to_string(mapping.globalRemoteRank), nameRequester));
+  }
+
+  com::Request::wait(requests);
+  requests.clear();
+  // assertion(c->getRemoteCommunicatorSize() == 1);
 
   for (auto &mapping : _mappings) {
-    mapping.offset = _buffer.size();
-    _buffer.resize(_buffer.size() + mapping.indices.size() * valueDimension);
+    CHECK(mapping.communication->isConnected(),
+          "Requesting connection to remote rank " << mapping.globalRemoteRank << " failed!");
+  }
 
-    mapping.request =
-        mapping.communication->aReceive(_buffer.data() + mapping.offset,
-                                        mapping.indices.size() * valueDimension,
-                                        mapping.localRemoteRank);
+  for (auto &mapping : _mappings) {
+    requests.push_back(mapping.communication->aSend(&utils::MasterSlave::_rank, 1, 0));
   }
 
+  com::Request::wait(requests);
+  setupMappings();
+  _isConnected = true;
+}
+
+PointToPointCommunication::Mapping &PointToPointCommunication::findMapping(int globalRemoteRank)
+{
   for (auto &mapping : _mappings) {
-    mapping.request->wait();
+    if (mapping.globalRemoteRank == globalRemoteRank) {
+      return mapping;
+    }
+  }
+  ERROR("Rank " << globalRemoteRank << " is not connected to this rank.");
+}
 
-    int i = 0;
+void PointToPointCommunication::setupMappings()
+{
+  // Number of remote process ranks each local data index is communicated with.
+  std::vector<int> partnerCounts(_localIndexCount, 0);
+
+  for (auto const &mapping : _mappings) {
+    for (auto index : mapping.indices) {
+      partnerCounts[index]++;
+    }
+  }
+
+  for (auto &mapping : _mappings) {
+    mapping.runs.clear();
+    mapping.isExclusive = true;
 
     for (auto index : mapping.indices) {
-      for (int d = 0; d < valueDimension; ++d) {
-        itemsToReceive[index * valueDimension + d] += _buffer[mapping.offset + i * valueDimension + d];
+      if (not mapping.runs.empty() &&
+          mapping.runs.back().first + mapping.runs.back().second == index) {
+        mapping.runs.back().second++;
+      } else {
+        mapping.runs.emplace_back(index, 1);
       }
 
-      i++;
+      if (partnerCounts[index] > 1)
+        mapping.isExclusive = false;
     }
-  }
 
-  _buffer.clear();
+    if (not mapping.receivesDirectly()) {
+      mapping.buffer.resize(mapping.indices.size() * _mesh->getDimensions());
+    }
+  }
 }
 } // namespace m2n
 } // namespace precice
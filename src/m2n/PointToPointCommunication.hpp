@@ -1,14 +1,38 @@
 #pragma once
 
+#include <map>
 #include "DistributedCommunication.hpp"
 #include "com/SharedPointer.hpp"
 #include "logging/Logger.hpp"
+#include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
+#include "utils/MasterSlave.hpp"
 
 namespace precice
 {
 namespace m2n
 {
+/**
+ * @brief Builds the local communication map of a process rank.
+ *
+ * The communication map defines a mapping from a process rank in the remote
+ * participant to an array of local data indices, which define a subset of local
+ * (for the given process rank in the current participant) data to be
+ * communicated between both process ranks. Remote ranks without matching
+ * indices are not contained.
+ *
+ * @param[out] localIndexCount Number of local data indices of the given rank, or
+ *             0 if it has no communication partners at all.
+ * @param[in] thisVertexDistribution Vertex distribution of this participant.
+ * @param[in] otherVertexDistribution Vertex distribution of the remote participant.
+ * @param[in] thisRank Process rank in this participant.
+ */
+std::map<int, std::vector<int>> buildCommunicationMap(
+    size_t &                              localIndexCount,
+    mesh::Mesh::VertexDistribution const &thisVertexDistribution,
+    mesh::Mesh::VertexDistribution const &otherVertexDistribution,
+    int                                   thisRank = utils::MasterSlave::_rank);
+
 /**
  * @brief Point-to-point communication implementation of DistributedCommunication.
  *
@@ -65,6 +89,40 @@ public:
   virtual void requestConnection(std::string const &nameAcceptor,
                                  std::string const &nameRequester);
 
+  /**
+   * @brief Accepts connections from the given remote process ranks only, which
+   *        have to call requestPreConnection().
+   *
+   * Used to exchange meshes directly between the process ranks of both
+   * participants before the vertex distribution is known. The connection has
+   * to be closed before acceptConnection() can be called.
+   *
+   * @param[in] nameAcceptor  Name of calling participant.
+   * @param[in] nameRequester Name of remote participant to connect to.
+   * @param[in] remoteRanks   Global ranks of the remote processes to connect to.
+   */
+  virtual void acceptPreConnection(std::string const &     nameAcceptor,
+                                   std::string const &     nameRequester,
+                                   std::vector<int> const &remoteRanks);
+
+  /**
+   * @brief Requests connections from the given remote process ranks only, which
+   *        have to call acceptPreConnection().
+   *
+   * @param[in] nameAcceptor  Name of remote participant to connect to.
+   * @param[in] nameRequester Name of calling participant.
+   * @param[in] remoteRanks   Global ranks of the remote processes to connect to.
+   */
+  virtual void requestPreConnection(std::string const &     nameAcceptor,
+                                    std::string const &     nameRequester,
+                                    std::vector<int> const &remoteRanks);
+
+  /// Sends a mesh to a connected remote process rank.
+  virtual void sendMesh(mesh::Mesh &mesh, int remoteRank);
+
+  /// Receives a mesh from a connected remote process rank and adds it to the given mesh.
+  virtual void receiveMesh(mesh::Mesh &mesh, int remoteRank);
+
   /**
    * @brief Disconnects from communication space, i.e. participant.
    *
@@ -75,16 +133,23 @@ public:
   /**
    * @brief Sends a subset of local double values corresponding to local indices
    *        deduced from the current and remote vertex distributions.
+   *
+   * If a compressor is given, the subset of each remote process is compressed
+   * on the channel of its global rank.
    */
-  virtual void send(double *itemsToSend, size_t size, int valueDimension = 1);
+  virtual void send(double *    itemsToSend,
+                    size_t      size,
+                    int         valueDimension = 1,
+                    Compressor *compressor     = nullptr);
 
   /**
    * @brief Receives a subset of local double values corresponding to local
    *        indices deduced from the current and remote vertex distributions.
    */
-  virtual void receive(double *itemsToReceive,
-                       size_t  size,
-                       int     valueDimension = 1);
+  virtual void receive(double *    itemsToReceive,
+                       size_t      size,
+                       int         valueDimension = 1,
+                       Compressor *compressor     = nullptr);
 
 private:
   logging::Logger _log{"m2n::PointToPointCommunication"};
@@ -101,25 +166,79 @@ private:
    *           rank in the current participant) data to be communicated between
    *           the current process rank and the remote process rank;
    *        4. communication object (provides point-to-point communication
-   *           routines).
+   *           routines);
+   *        5. buffer for packing and unpacking the communicated data subset,
+   *           allocated once for the largest value dimension when the
+   *           connection is established;
+   *        6. persistent send and receive requests on the buffer, created on
+   *           first use for each value dimension and restarted on every
+   *           following exchange;
+   *        7. contiguous runs of local data indices, stored as pairs of first
+   *           index and length;
+   *        8. whether the local data indices are communicated with this remote
+   *           process rank only;
+   *        9. compressed data subset and its size, which are kept here since
+   *           both are sent and received asynchronously.
+   *
+   * If the local data indices form a single run, the data subset is sent
+   * directly from the data array without packing. If, in addition, no other
+   * remote process rank shares these indices, it is also received directly
+   * into the data array and no buffer is allocated.
    */
   struct Mapping {
-    int                   localRemoteRank;
-    int                   globalRemoteRank;
-    std::vector<int>      indices;
-    com::PtrCommunication communication;
-    com::PtrRequest       request;
-    size_t                offset;
+    int                              localRemoteRank;
+    int                              globalRemoteRank;
+    std::vector<int>                 indices;
+    com::PtrCommunication            communication;
+    std::vector<double>              buffer;
+    std::map<int, com::PtrRequest>   sendRequests;
+    std::map<int, com::PtrRequest>   receiveRequests;
+    std::vector<std::pair<int, int>> runs;
+    bool                             isExclusive;
+    std::vector<int>                 encoded;
+    int                              encodedSize;
+
+    /// Returns true, if the data subset is received directly into the data array.
+    bool receivesDirectly() const
+    {
+      return runs.size() == 1 && isExclusive;
+    }
   };
 
+  /**
+   * @brief Accepts (as server) connections from the remote process ranks of
+   *        the communication map and sets up the mappings.
+   */
+  void acceptRemoteRanks(std::string const &              nameAcceptor,
+                         std::string const &              nameRequester,
+                         std::map<int, std::vector<int>> &communicationMap);
+
+  /**
+   * @brief Requests (as client) connections to the remote process ranks of
+   *        the communication map and sets up the mappings.
+   */
+  void requestRemoteRanks(std::string const &              nameAcceptor,
+                          std::string const &              nameRequester,
+                          std::map<int, std::vector<int>> &communicationMap);
+
+  /// Returns the mapping of the given global remote process rank.
+  Mapping &findMapping(int globalRemoteRank);
+
+  /// Detects the contiguous index runs and allocates the buffers of all mappings.
+  void setupMappings();
+
+  /// Sends the compressed subset of each mapping, the size of the encoded data first.
+  void sendCompressed(double *itemsToSend, int valueDimension, Compressor &compressor);
+
+  /// Receives and decompresses the subsets sent by sendCompressed().
+  void receiveCompressed(double *itemsToReceive, int valueDimension, Compressor &compressor);
+
   /**
    * @brief Local (for process rank in the current participant) vector of
    *        mappings (one to service each point-to-point connection).
    */
   std::vector<Mapping> _mappings;
 
-  std::vector<double> _buffer;
-
   size_t _localIndexCount = 0;
 
   size_t _totalIndexCount = 0;
@@ -8,8 +8,10 @@ namespace m2n
 {
 
 class M2N;
+class Compressor;
 
-using PtrM2N = std::shared_ptr<M2N>;
+using PtrM2N        = std::shared_ptr<M2N>;
+using PtrCompressor = std::shared_ptr<Compressor>;
 
 } // namespace m2n
 } // namespace precice
@@ -53,6 +53,35 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
     attrExchangeDirectory.setDefaultValue("");
     tag.addAttribute(attrExchangeDirectory);
 
+    XMLAttribute<int> attrIOThreads(ATTR_IO_THREADS);
+    doc = "Number of threads running asynchronous socket operations. More threads ";
+    doc += "can help to saturate fast networks, if a process communicates with many ";
+    doc += "partners in point-to-point mode.";
+    attrIOThreads.setDocumentation(doc);
+    attrIOThreads.setDefaultValue(1);
+    tag.addAttribute(attrIOThreads);
+
+    XMLAttribute<bool> attrNoDelay(ATTR_NO_DELAY);
+    doc = "Disables Nagle's algorithm (TCP_NODELAY), such that small messages ";
+    doc += "are sent immediately.";
+    attrNoDelay.setDocumentation(doc);
+    attrNoDelay.setDefaultValue(false);
+    tag.addAttribute(attrNoDelay);
+
+    XMLAttribute<int> attrSendBufferSize(ATTR_SEND_BUFFER_SIZE);
+    doc = "Size of the socket send buffers in bytes. The default is \"0\", what ";
+    doc += "means that the system default is used.";
+    attrSendBufferSize.setDocumentation(doc);
+    attrSendBufferSize.setDefaultValue(0);
+    tag.addAttribute(attrSendBufferSize);
+
+    XMLAttribute<int> attrReceiveBufferSize(ATTR_RECEIVE_BUFFER_SIZE);
+    doc = "Size of the socket receive buffers in bytes. The default is \"0\", what ";
+    doc += "means that the system default is used.";
+    attrReceiveBufferSize.setDocumentation(doc);
+    attrReceiveBufferSize.setDefaultValue(0);
+    tag.addAttribute(attrReceiveBufferSize);
+
     tags.push_back(tag);
   }
   {
@@ -98,6 +127,13 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
   attrDistrTypeOnly.setValidator(validDistrGatherScatter);
   attrDistrTypeOnly.setDefaultValue(VALUE_GATHER_SCATTER);
 
+  XMLAttribute<bool> attrTwoLevelInit(ATTR_USE_TWO_LEVEL_INIT);
+  doc = "Exchanges received meshes directly between the ranks of both participants, whose ";
+  doc += "bounding boxes overlap, instead of gathering and filtering them on the master. ";
+  doc += "Only supported by the \"" + VALUE_POINT_TO_POINT + "\" distribution type.";
+  attrTwoLevelInit.setDocumentation(doc);
+  attrTwoLevelInit.setDefaultValue(false);
+
   XMLAttribute<std::string> attrFrom(ATTR_FROM);
   doc = "First participant name involved in communication. For performance reasons, we recommend to use ";
   doc += "the participant with less ranks at the coupling interface as \"from\" in the m2n communication.";
@@ -111,6 +147,7 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
     tag.addAttribute(attrTo);
     if (tag.getName() == VALUE_MPI || tag.getName() == VALUE_SOCKETS) {
       tag.addAttribute(attrDistrTypeBoth);
+      tag.addAttribute(attrTwoLevelInit);
     } else {
       tag.addAttribute(attrDistrTypeOnly);
     }
@@ -144,6 +181,13 @@ void M2NConfiguration::xmlTagCallback(
     std::string to   = tag.getStringAttributeValue(ATTR_TO);
     checkDuplicates(from, to);
     std::string distrType = tag.getStringAttributeValue(ATTR_DISTRIBUTION_TYPE);
+    bool twoLevelInit = false;
+    if (tag.getName() == VALUE_MPI || tag.getName() == VALUE_SOCKETS) {
+      twoLevelInit = tag.getBooleanAttributeValue(ATTR_USE_TWO_LEVEL_INIT);
+      CHECK(not twoLevelInit || distrType == VALUE_POINT_TO_POINT,
+            "The \"" << ATTR_USE_TWO_LEVEL_INIT << "\" attribute requires distribution-type \""
+                     << VALUE_POINT_TO_POINT << "\".");
+    }
 
     com::PtrCommunicationFactory comFactory;
     com::PtrCommunication        com;
@@ -154,8 +198,19 @@ void M2NConfiguration::xmlTagCallback(
       CHECK(not utils::isTruncated<unsigned short>(port),
             "The value given for the \"port\" attribute is not a 16-bit unsigned integer: " << port);
 
+      int  ioThreads         = tag.getIntAttributeValue(ATTR_IO_THREADS);
+      bool noDelay           = tag.getBooleanAttributeValue(ATTR_NO_DELAY);
+      int  sendBufferSize    = tag.getIntAttributeValue(ATTR_SEND_BUFFER_SIZE);
+      int  receiveBufferSize = tag.getIntAttributeValue(ATTR_RECEIVE_BUFFER_SIZE);
+
+      CHECK(ioThreads > 0,
+            "The value given for the \"" << ATTR_IO_THREADS << "\" attribute has to be positive: " << ioThreads);
+      CHECK(sendBufferSize >= 0 && receiveBufferSize >= 0,
+            "Socket buffer sizes must not be negative!");
+
       std::string dir = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
-      comFactory      = std::make_shared<com::SocketCommunicationFactory>(port, false, network, dir);
+      comFactory      = std::make_shared<com::SocketCommunicationFactory>(
+          port, false, network, dir, ioThreads, noDelay, sendBufferSize, receiveBufferSize);
       com             = comFactory->newCommunication();
     } else if (tag.getName() == VALUE_MPI) {
       std::string dir = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
@@ -191,7 +246,7 @@ void M2NConfiguration::xmlTagCallback(
     }
     assertion(distrFactory.get() != nullptr);
 
-    auto m2n = std::make_shared<m2n::M2N>(com, distrFactory);
+    auto m2n = std::make_shared<m2n::M2N>(com, distrFactory, twoLevelInit);
     _m2ns.push_back(std::make_tuple(m2n, from, to));
   }
 }
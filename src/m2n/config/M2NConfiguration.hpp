@@ -51,14 +51,19 @@ public:
 private:
   logging::Logger _log{"m2n::M2NConfiguration"};
 
-  const std::string TAG                     = "m2n";
-  const std::string ATTR_TYPE               = "type";
-  const std::string ATTR_DISTRIBUTION_TYPE  = "distribution-type";
-  const std::string ATTR_FROM               = "from";
-  const std::string ATTR_TO                 = "to";
-  const std::string ATTR_PORT               = "ports";
-  const std::string ATTR_NETWORK            = "network";
-  const std::string ATTR_EXCHANGE_DIRECTORY = "exchange-directory";
+  const std::string TAG                      = "m2n";
+  const std::string ATTR_TYPE                = "type";
+  const std::string ATTR_DISTRIBUTION_TYPE   = "distribution-type";
+  const std::string ATTR_FROM                = "from";
+  const std::string ATTR_TO                  = "to";
+  const std::string ATTR_PORT                = "ports";
+  const std::string ATTR_NETWORK             = "network";
+  const std::string ATTR_EXCHANGE_DIRECTORY  = "exchange-directory";
+  const std::string ATTR_IO_THREADS          = "io-threads";
+  const std::string ATTR_NO_DELAY            = "no-delay";
+  const std::string ATTR_SEND_BUFFER_SIZE    = "send-buffer-size";
+  const std::string ATTR_RECEIVE_BUFFER_SIZE = "receive-buffer-size";
+  const std::string ATTR_USE_TWO_LEVEL_INIT  = "use-two-level-initialization";
 
   const std::string VALUE_MPI        = "mpi";
   const std::string VALUE_MPI_SINGLE = "mpi-single";
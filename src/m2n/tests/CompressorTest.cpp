@@ -0,0 +1,143 @@
+#include <cmath>
+#include <vector>
+#include "m2n/Compressor.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::m2n;
+
+BOOST_AUTO_TEST_SUITE(M2NTests)
+BOOST_AUTO_TEST_SUITE(CompressorTests)
+
+namespace
+{
+
+/// Smooth values, as typical for coupling data.
+std::vector<double> smoothValues(int size, double time)
+{
+  std::vector<double> values(size);
+  for (int i = 0; i < size; i++) {
+    values[i] = std::sin(0.01 * i + time);
+  }
+  return values;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(Lossless, *testing::OnMaster())
+{
+  Compressor sender("Data", Compressor::Mode::LOSSLESS);
+  Compressor receiver("Data", Compressor::Mode::LOSSLESS);
+
+  std::vector<double> values = smoothValues(1000, 0.0);
+  values[10]                 = 0.0;
+  values[11]                 = -1e300;
+  values[12]                 = 1e-300;
+  std::vector<int>    encoded;
+  std::vector<double> decoded(values.size());
+  sender.compress(0, values.data(), values.size(), encoded);
+  receiver.decompress(0, encoded, decoded.data(), decoded.size());
+  BOOST_TEST(decoded == values);
+}
+
+BOOST_AUTO_TEST_CASE(Delta, *testing::OnMaster())
+{
+  Compressor sender("Data", Compressor::Mode::DELTA);
+  Compressor receiver("Data", Compressor::Mode::DELTA);
+
+  std::vector<int> encoded;
+  for (int step = 0; step < 3; step++) {
+    for (int channel = 0; channel < 2; channel++) {
+      std::vector<double> values = smoothValues(500 + channel, step + channel);
+      std::vector<double> decoded(values.size());
+      sender.compress(channel, values.data(), values.size(), encoded);
+      receiver.decompress(channel, encoded, decoded.data(), decoded.size());
+      BOOST_TEST(decoded == values);
+    }
+  }
+
+  // Unchanged values are encoded by very few bytes.
+  std::vector<double> values = smoothValues(501, 3.0);
+  std::vector<double> decoded(values.size());
+  sender.compress(1, values.data(), values.size(), encoded);
+  receiver.decompress(1, encoded, decoded.data(), decoded.size());
+  sender.compress(1, values.data(), values.size(), encoded);
+  receiver.decompress(1, encoded, decoded.data(), decoded.size());
+  BOOST_TEST(decoded == values);
+  BOOST_TEST(encoded.size() * sizeof(int) < values.size());
+}
+
+BOOST_AUTO_TEST_CASE(Lossy, *testing::OnMaster())
+{
+  double     tolerance = 1e-6;
+  Compressor sender("Data", Compressor::Mode::LOSSY, tolerance);
+  Compressor receiver("Data", Compressor::Mode::LOSSY, tolerance);
+
+  std::vector<int> encoded;
+  for (int step = 0; step < 3; step++) {
+    std::vector<double> values = smoothValues(1000, 0.1 * step);
+    std::vector<double> decoded(values.size());
+    sender.compress(0, values.data(), values.size(), encoded);
+    receiver.decompress(0, encoded, decoded.data(), decoded.size());
+    for (size_t i = 0; i < values.size(); i++) {
+      BOOST_TEST(std::abs(decoded[i] - values[i]) <= tolerance * std::abs(values[i]));
+    }
+    BOOST_TEST(encoded.size() * sizeof(int) < values.size() * sizeof(double));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Sparse, *testing::OnMaster())
+{
+  Compressor sender("Data", Compressor::Mode::SPARSE);
+  Compressor receiver("Data", Compressor::Mode::SPARSE);
+
+  // The first exchange changes all values and is sent densely.
+  std::vector<double> values = smoothValues(1000, 0.0);
+  std::vector<double> decoded(values.size());
+  std::vector<int>    encoded;
+  sender.compress(0, values.data(), values.size(), encoded);
+  receiver.decompress(0, encoded, decoded.data(), decoded.size());
+  BOOST_TEST(decoded == values);
+
+  // Only the changed values and the bitmap are sent.
+  values[1]   = 2.0;
+  values[500] = -3.0;
+  sender.compress(0, values.data(), values.size(), encoded);
+  receiver.decompress(0, encoded, decoded.data(), decoded.size());
+  BOOST_TEST(decoded == values);
+  BOOST_TEST(encoded.size() * sizeof(int) < values.size() / 4);
+
+  // All values changed.
+  values = smoothValues(1000, 1.0);
+  sender.compress(0, values.data(), values.size(), encoded);
+  receiver.decompress(0, encoded, decoded.data(), decoded.size());
+  BOOST_TEST(decoded == values);
+}
+
+BOOST_AUTO_TEST_CASE(SparseTolerance, *testing::OnMaster())
+{
+  double     tolerance = 1e-3;
+  Compressor sender("Data", Compressor::Mode::SPARSE, tolerance);
+  Compressor receiver("Data", Compressor::Mode::SPARSE, tolerance);
+
+  std::vector<double> transmitted = smoothValues(1000, 0.0);
+  std::vector<double> decoded(transmitted.size());
+  std::vector<int>    encoded;
+  sender.compress(0, transmitted.data(), transmitted.size(), encoded);
+  receiver.decompress(0, encoded, decoded.data(), decoded.size());
+
+  // Changes below the tolerance are not sent, the receiver keeps the values sent last.
+  std::vector<double> values = transmitted;
+  for (auto &value : values) {
+    value *= 1.0 + 0.5 * tolerance;
+  }
+  values[7] = 10.0;
+  sender.compress(0, values.data(), values.size(), encoded);
+  receiver.decompress(0, encoded, decoded.data(), decoded.size());
+  for (size_t i = 0; i < values.size(); i++) {
+    BOOST_TEST(decoded[i] == (i == 7 ? 10.0 : transmitted[i]));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // CompressorTests
+BOOST_AUTO_TEST_SUITE_END() // M2NTests
@@ -1,8 +1,10 @@
 #ifndef PRECICE_NO_MPI
 
 #include "com/MPIDirectCommunication.hpp"
+#include "m2n/Compressor.hpp"
 #include "m2n/DistributedComFactory.hpp"
 #include "m2n/GatherScatterComFactory.hpp"
+#include "m2n/GatherScatterCommunication.hpp"
 #include "m2n/M2N.hpp"
 #include "m2n/SharedPointer.hpp"
 #include "mesh/Mesh.hpp"
@@ -17,7 +19,11 @@ BOOST_AUTO_TEST_SUITE(M2NTests)
 using namespace precice;
 using namespace m2n;
 
-BOOST_AUTO_TEST_CASE(GatherScatterTest, *testing::OnSize(4))
+namespace
+{
+
+/// Connects a serial participant (rank 0) to a participant with a master (rank 1) and two slaves.
+m2n::PtrM2N connectGatherScatter()
 {
   assertion(utils::Parallel::getCommunicatorSize() == 4);
 
@@ -75,6 +81,90 @@ BOOST_AUTO_TEST_CASE(GatherScatterTest, *testing::OnSize(4))
 
   utils::Parallel::synchronizeProcesses();
 
+  return m2n;
+}
+
+/// Resets the master-slave configuration after a test.
+void disconnectGatherScatter()
+{
+  utils::MasterSlave::_communication.reset();
+  utils::MasterSlave::_rank       = utils::Parallel::getProcessRank();
+  utils::MasterSlave::_size       = utils::Parallel::getCommunicatorSize();
+  utils::MasterSlave::_slaveMode  = false;
+  utils::MasterSlave::_masterMode = false;
+
+  utils::Parallel::synchronizeProcesses();
+  utils::Parallel::clearGroups();
+}
+
+/**
+ * @brief Exchanges the values of a mesh spanning several chunks between the serial participant
+ *        and the master and slaves, which double the values and send them back.
+ */
+void exchangeChunks(m2n::PtrM2N m2n, Compressor *compressor)
+{
+  int  dimensions       = 2;
+  int  numberOfVertices = 2 * GatherScatterCommunication::CHUNK_VERTICES + 5;
+  bool flipNormals      = false;
+  int  valueDimension   = 2;
+
+  mesh::PtrMesh pMesh(new mesh::Mesh("Mesh", dimensions, flipNormals));
+  m2n->createDistributedCommunication(pMesh);
+
+  if (utils::Parallel::getProcessRank() == 0) { // Part1
+    m2n->acceptSlavesConnection("Part1", "Part2Master");
+    Eigen::VectorXd values(numberOfVertices * valueDimension);
+    for (int i = 0; i < values.size(); i++) {
+      values[i] = i;
+    }
+    m2n->send(values.data(), values.size(), pMesh->getID(), valueDimension, compressor);
+    m2n->receive(values.data(), values.size(), pMesh->getID(), valueDimension, compressor);
+    // Vertex 0 is shared by the master and slave 2, all others are held by a single rank.
+    BOOST_TEST(values[0] == 0.0);
+    BOOST_TEST(values[1] == 4.0);
+    for (int i = valueDimension; i < values.size(); i++) {
+      BOOST_TEST(values[i] == 2.0 * i);
+    }
+  } else {
+    m2n->requestSlavesConnection("Part1", "Part2Master");
+
+    // The master holds the even vertices, slave 2 the odd vertices and vertex 0.
+    std::vector<int> vertices;
+    if (utils::Parallel::getProcessRank() == 1) { // Master
+      pMesh->setGlobalNumberOfVertices(numberOfVertices);
+      for (int i = 0; i < numberOfVertices; i += 2) {
+        pMesh->getVertexDistribution()[0].push_back(i);
+      }
+      pMesh->getVertexDistribution()[2].push_back(0);
+      for (int i = 1; i < numberOfVertices; i += 2) {
+        pMesh->getVertexDistribution()[2].push_back(i);
+      }
+      vertices = pMesh->getVertexDistribution()[0];
+    } else if (utils::Parallel::getProcessRank() == 3) { // Slave2
+      vertices.push_back(0);
+      for (int i = 1; i < numberOfVertices; i += 2) {
+        vertices.push_back(i);
+      }
+    }
+
+    Eigen::VectorXd values = Eigen::VectorXd::Zero(vertices.size() * valueDimension);
+    m2n->receive(values.data(), values.size(), pMesh->getID(), valueDimension, compressor);
+    for (size_t i = 0; i < vertices.size(); i++) {
+      for (int j = 0; j < valueDimension; j++) {
+        BOOST_TEST(values[i * valueDimension + j] == vertices[i] * valueDimension + j);
+      }
+    }
+    values = values * 2;
+    m2n->send(values.data(), values.size(), pMesh->getID(), valueDimension, compressor);
+  }
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(GatherScatterTest, *testing::OnSize(4))
+{
+  m2n::PtrM2N m2n = connectGatherScatter();
+
   int             dimensions       = 2;
   int             numberOfVertices = 6;
   bool            flipNormals      = false;
@@ -135,14 +225,24 @@ BOOST_AUTO_TEST_CASE(GatherScatterTest, *testing::OnSize(4))
     }
   }
 
-  utils::MasterSlave::_communication.reset();
-  utils::MasterSlave::_rank       = utils::Parallel::getProcessRank();
-  utils::MasterSlave::_size       = utils::Parallel::getCommunicatorSize();
-  utils::MasterSlave::_slaveMode  = false;
-  utils::MasterSlave::_masterMode = false;
+  disconnectGatherScatter();
+}
 
-  utils::Parallel::synchronizeProcesses();
-  utils::Parallel::clearGroups();
+BOOST_AUTO_TEST_CASE(GatherScatterChunks, *testing::OnSize(4))
+{
+  m2n::PtrM2N m2n = connectGatherScatter();
+  exchangeChunks(m2n, nullptr);
+  disconnectGatherScatter();
+}
+
+BOOST_AUTO_TEST_CASE(GatherScatterCompressed, *testing::OnSize(4))
+{
+  m2n::PtrM2N m2n = connectGatherScatter();
+  Compressor  compressor("Data", Compressor::Mode::DELTA);
+  // The second exchange is encoded relative to the first one.
+  exchangeChunks(m2n, &compressor);
+  exchangeChunks(m2n, &compressor);
+  disconnectGatherScatter();
 }
 
 BOOST_AUTO_TEST_SUITE_END()
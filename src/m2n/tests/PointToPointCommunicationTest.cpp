@@ -1,9 +1,11 @@
 #ifndef PRECICE_NO_MPI
 
+#include <chrono>
 #include <vector>
 #include "com/MPIDirectCommunication.hpp"
 #include "com/MPIPortsCommunicationFactory.hpp"
 #include "com/SocketCommunicationFactory.hpp"
+#include "m2n/Compressor.hpp"
 #include "m2n/PointToPointCommunication.hpp"
 #include "mesh/Mesh.hpp"
 #include "testing/Testing.hpp"
@@ -136,24 +138,38 @@ void P2PComTest1(com::PtrCommunicationFactory cf)
   }
   }
 
+  vector<double> initialData = data;
+
   if (Parallel::getProcessRank() < 2) {
     c.requestConnection("B", "A");
+  } else {
+    c.acceptConnection("B", "A");
+  }
 
-    c.send(data.data(), data.size());
+  // Repeat the exchange to reuse the buffers and requests of the first one,
+  // then exchange compressed values twice, the second time relative to the first.
+  m2n::Compressor compressor("Data", m2n::Compressor::Mode::DELTA);
 
-    c.receive(data.data(), data.size());
+  for (int round = 0; round < 4; ++round) {
+    m2n::Compressor *roundCompressor = round < 2 ? nullptr : &compressor;
 
-    BOOST_TEST(data == expectedData);
-  } else {
-    c.acceptConnection("B", "A");
+    data = initialData;
 
-    c.receive(data.data(), data.size());
+    if (Parallel::getProcessRank() < 2) {
+      c.send(data.data(), data.size(), 1, roundCompressor);
 
-    BOOST_TEST(data == expectedData);
+      c.receive(data.data(), data.size(), 1, roundCompressor);
 
-    process(data);
+      BOOST_TEST(data == expectedData);
+    } else {
+      c.receive(data.data(), data.size(), 1, roundCompressor);
 
-    c.send(data.data(), data.size());
+      BOOST_TEST(data == expectedData);
+
+      process(data);
+
+      c.send(data.data(), data.size(), 1, roundCompressor);
+    }
   }
 
   MasterSlave::_communication.reset();
@@ -300,12 +316,129 @@ void P2PComTest2(com::PtrCommunicationFactory cf)
   utils::Parallel::clearGroups();
 }
 
+/// block distributions, such that all partners communicate contiguous index ranges
+void P2PComTest3(com::PtrCommunicationFactory cf)
+{
+  assertion(Parallel::getCommunicatorSize() == 4);
+
+  MasterSlave::_communication = std::make_shared<com::MPIDirectCommunication>();
+
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 2, true));
+
+  m2n::PointToPointCommunication c(cf, mesh);
+
+  vector<double> data;
+  vector<double> expectedData;
+
+  switch (Parallel::getProcessRank()) {
+  case 0: {
+    Parallel::splitCommunicator("A.Master");
+
+    MasterSlave::_rank       = 0;
+    MasterSlave::_size       = 2;
+    MasterSlave::_masterMode = true;
+    MasterSlave::_slaveMode  = false;
+
+    MasterSlave::_communication->acceptConnection("A.Master", "A.Slave");
+    MasterSlave::_communication->setRankOffset(1);
+
+    mesh->setGlobalNumberOfVertices(6);
+
+    mesh->getVertexDistribution()[0] = {0, 1, 2};
+    mesh->getVertexDistribution()[1] = {3, 4, 5};
+
+    data         = {10, 11, 20, 21, 30, 31};
+    expectedData = {11, 12, 21, 22, 31, 32};
+
+    break;
+  }
+  case 1: {
+    Parallel::splitCommunicator("A.Slave");
+
+    MasterSlave::_rank       = 1;
+    MasterSlave::_size       = 2;
+    MasterSlave::_masterMode = false;
+    MasterSlave::_slaveMode  = true;
+
+    MasterSlave::_communication->requestConnection("A.Master", "A.Slave", 0, 1);
+
+    data         = {40, 41, 50, 51, 60, 61};
+    expectedData = {41, 42, 52, 53, 62, 63};
+
+    break;
+  }
+  case 2: {
+    Parallel::splitCommunicator("B.Master");
+
+    MasterSlave::_rank       = 0;
+    MasterSlave::_size       = 2;
+    MasterSlave::_masterMode = true;
+    MasterSlave::_slaveMode  = false;
+
+    MasterSlave::_communication->acceptConnection("B.Master", "B.Slave");
+    MasterSlave::_communication->setRankOffset(1);
+
+    mesh->setGlobalNumberOfVertices(6);
+
+    mesh->getVertexDistribution()[0] = {0, 1, 2, 3};
+    mesh->getVertexDistribution()[1] = {4, 5};
+
+    data         = vector<double>(8, -1);
+    expectedData = {10, 11, 20, 21, 30, 31, 40, 41};
+
+    break;
+  }
+  case 3: {
+    Parallel::splitCommunicator("B.Slave");
+
+    MasterSlave::_rank       = 1;
+    MasterSlave::_size       = 2;
+    MasterSlave::_masterMode = false;
+    MasterSlave::_slaveMode  = true;
+
+    MasterSlave::_communication->requestConnection("B.Master", "B.Slave", 0, 1);
+
+    data         = vector<double>(4, -1);
+    expectedData = {50, 51, 60, 61};
+
+    break;
+  }
+  }
+
+  if (Parallel::getProcessRank() < 2) {
+    c.requestConnection("B", "A");
+
+    c.send(data.data(), data.size(), 2);
+
+    c.receive(data.data(), data.size(), 2);
+
+    BOOST_TEST(data == expectedData);
+  } else {
+    c.acceptConnection("B", "A");
+
+    c.receive(data.data(), data.size(), 2);
+
+    BOOST_TEST(data == expectedData);
+
+    process(data);
+
+    c.send(data.data(), data.size(), 2);
+  }
+
+  MasterSlave::_communication.reset();
+  MasterSlave::reset();
+
+  Parallel::synchronizeProcesses();
+  utils::Parallel::clearGroups();
+}
+
 BOOST_AUTO_TEST_CASE(SocketCommunication, *testing::OnSize(4))
 {
   com::PtrCommunicationFactory cf(new com::SocketCommunicationFactory);
   if (utils::Parallel::getProcessRank() < 4) {
     P2PComTest1(cf);
     P2PComTest2(cf);
+    P2PComTest3(cf);
   }
 }
 
@@ -317,7 +450,107 @@ BOOST_AUTO_TEST_CASE(MPIPortsCommunication,
   if (utils::Parallel::getProcessRank() < 4) {
     P2PComTest1(cf);
     P2PComTest2(cf);
+    P2PComTest3(cf);
+  }
+}
+
+/// Reference implementation comparing every local index with every remote index.
+std::map<int, std::vector<int>> buildCommunicationMapReference(
+    mesh::Mesh::VertexDistribution const &thisVertexDistribution,
+    mesh::Mesh::VertexDistribution const &otherVertexDistribution,
+    int                                   thisRank)
+{
+  std::map<int, std::vector<int>> communicationMap;
+
+  int index = 0;
+  for (int thisIndex : thisVertexDistribution.at(thisRank)) {
+    for (const auto &other : otherVertexDistribution) {
+      for (const auto &otherIndex : other.second) {
+        if (thisIndex == otherIndex) {
+          communicationMap[other.first].push_back(index);
+          break;
+        }
+      }
+    }
+    ++index;
+  }
+  return communicationMap;
+}
+
+BOOST_AUTO_TEST_CASE(BuildCommunicationMap, *testing::OnMaster())
+{
+  mesh::Mesh::VertexDistribution thisDistribution;
+  mesh::Mesh::VertexDistribution otherDistribution;
+
+  thisDistribution[0] = {0, 1, 3, 5, 7};
+  thisDistribution[1] = {1, 2, 4, 5, 6};
+  thisDistribution[2] = {100, 1000000};
+
+  otherDistribution[0] = {1, 2, 5, 6};
+  otherDistribution[1] = {0, 1, 3, 4, 5, 5, 7};
+  otherDistribution[2] = {1000000};
+
+  size_t localIndexCount = 0;
+
+  auto communicationMap = buildCommunicationMap(localIndexCount, thisDistribution, otherDistribution, 0);
+  BOOST_TEST(localIndexCount == 5);
+  BOOST_TEST(communicationMap.size() == 2);
+  BOOST_TEST(communicationMap[0] == vector<int>({1, 3}));
+  BOOST_TEST(communicationMap[1] == vector<int>({0, 1, 2, 3, 4}));
+
+  // sparse indices are looked up by hash map
+  communicationMap = buildCommunicationMap(localIndexCount, thisDistribution, otherDistribution, 2);
+  BOOST_TEST(localIndexCount == 2);
+  BOOST_TEST(communicationMap.size() == 1);
+  BOOST_TEST(communicationMap[2] == vector<int>({1}));
+
+  communicationMap = buildCommunicationMap(localIndexCount, thisDistribution, otherDistribution, 3);
+  BOOST_TEST(localIndexCount == 0);
+  BOOST_TEST(communicationMap.empty());
+}
+
+/// Synthetic distribution on 1024 ranks: blocks on this side, overlapping strided blocks on the other side.
+BOOST_AUTO_TEST_CASE(BuildCommunicationMapManyRanks, *testing::OnMaster())
+{
+  int const ranks           = 1024;
+  int const verticesPerRank = 256;
+
+  mesh::Mesh::VertexDistribution thisDistribution;
+  mesh::Mesh::VertexDistribution otherDistribution;
+
+  for (int rank = 0; rank < ranks; ++rank) {
+    for (int i = 0; i < verticesPerRank; ++i) {
+      thisDistribution[rank].push_back(rank * verticesPerRank + i);
+      // shifted by half a block with one vertex of overlap, and stored in reverse
+      otherDistribution[rank].push_back(((rank + 1) * verticesPerRank - i + verticesPerRank / 2) % (ranks * verticesPerRank));
+    }
+  }
+
+  using Clock = std::chrono::steady_clock;
+  Clock::duration mapDuration       = Clock::duration::zero();
+  Clock::duration referenceDuration = Clock::duration::zero();
+
+  for (int rank : {0, ranks - 1}) {
+    size_t localIndexCount = 0;
+
+    auto start            = Clock::now();
+    auto communicationMap = buildCommunicationMap(localIndexCount, thisDistribution, otherDistribution, rank);
+    mapDuration += Clock::now() - start;
+
+    start             = Clock::now();
+    auto referenceMap = buildCommunicationMapReference(thisDistribution, otherDistribution, rank);
+    referenceDuration += Clock::now() - start;
+
+    BOOST_TEST(localIndexCount == static_cast<size_t>(verticesPerRank));
+    BOOST_CHECK(communicationMap == referenceMap);
   }
+
+  using std::chrono::microseconds;
+  BOOST_TEST_MESSAGE("buildCommunicationMap on " << ranks << " ranks: "
+                     << std::chrono::duration_cast<microseconds>(mapDuration).count() << " us, reference: "
+                     << std::chrono::duration_cast<microseconds>(referenceDuration).count() << " us");
+  // the reference compares every local vertex with every remote one, the map only looks each vertex up once
+  BOOST_TEST(mapDuration.count() < referenceDuration.count());
 }
 
 BOOST_AUTO_TEST_SUITE_END()
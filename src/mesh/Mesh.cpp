@@ -476,20 +476,28 @@ void Mesh:: computeState()
     }
   }
 
-  // Normalize vertex normals & compute bounding box
-  _boundingBox = BoundingBox (_dimensions,
-                              std::make_pair(std::numeric_limits<double>::max(),
-                                             std::numeric_limits<double>::lowest()));
-
-  for (Vertex& vertex : _content.vertices()) {
-    if (computeNormals) {
+  // Normalize vertex normals
+  if (computeNormals) {
+    for (Vertex& vertex : _content.vertices()) {
       double length = vertex.getNormal().norm();
       // there can be cases when a vertex has no edge though edges exist in general (e.g. after filtering)
       if(math::greater(length,0.0)){
         vertex.setNormal(vertex.getNormal() / length);
       }
     }
-    
+  }
+
+  computeBoundingBox();
+}
+
+void Mesh:: computeBoundingBox()
+{
+  TRACE(_name);
+  _boundingBox = BoundingBox (_dimensions,
+                              std::make_pair(std::numeric_limits<double>::max(),
+                                             std::numeric_limits<double>::lowest()));
+
+  for (const Vertex& vertex : _content.vertices()) {
     for (int d = 0; d < _dimensions; d++) {
       _boundingBox[d].first  = std::min(vertex.getCoords()[d], _boundingBox[d].first);
       _boundingBox[d].second = std::max(vertex.getCoords()[d], _boundingBox[d].second);
@@ -224,6 +224,9 @@ public:
    */
   void computeState();
 
+  /// Computes the bounding box of the mesh, which is also done by computeState().
+  void computeBoundingBox();
+
   /**
    * @brief Removes all mesh elements and data values (does not remove data).
    *
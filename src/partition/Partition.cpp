@@ -3,6 +3,9 @@
 #include "utils/Globals.hpp"
 #include "com/Communication.hpp"
 #include "utils/MasterSlave.hpp"
+#include "com/CommunicateBoundingBox.hpp"
+#include "m2n/M2N.hpp"
+#include <limits>
 
 
 namespace precice {
@@ -40,5 +43,65 @@ void Partition:: computeVertexOffsets(){
   }
 }
 
+mesh::Mesh::BoundingBoxMap Partition:: exchangeBoundingBoxes(const mesh::Mesh::BoundingBox& bb, bool sendFirst){
+  TRACE(sendFirst);
+  assertion(utils::MasterSlave::_masterMode || utils::MasterSlave::_slaveMode);
+
+  const mesh::Mesh::BoundingBox emptyBB(bb.size(), std::make_pair(std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest()));
+  mesh::Mesh::BoundingBoxMap remoteBBs;
+  int remoteSize = -1;
+
+  if (utils::MasterSlave::_slaveMode) {
+    com::CommunicateBoundingBox(utils::MasterSlave::_communication).sendBoundingBox(bb, 0);
+    utils::MasterSlave::_communication->broadcast(remoteSize, 0);
+    for (int rank = 0; rank < remoteSize; rank++) {
+      remoteBBs[rank] = emptyBB;
+    }
+    com::CommunicateBoundingBox(utils::MasterSlave::_communication).broadcastReceiveBoundingBoxMap(remoteBBs);
+  }
+  else { // Master
+    mesh::Mesh::BoundingBoxMap localBBs;
+    localBBs[0] = bb;
+    for (int rankSlave = 1; rankSlave < utils::MasterSlave::_size; rankSlave++) {
+      localBBs[rankSlave] = emptyBB;
+      com::CommunicateBoundingBox(utils::MasterSlave::_communication).receiveBoundingBox(localBBs[rankSlave], rankSlave);
+    }
+
+    com::PtrCommunication masterCom = _m2n->getMasterCommunication();
+    for (int step = 0; step < 2; step++) {
+      if (sendFirst == (step == 0)) {
+        masterCom->send(utils::MasterSlave::_size, 0);
+        com::CommunicateBoundingBox(masterCom).sendBoundingBoxMap(localBBs, 0);
+      }
+      else {
+        masterCom->receive(remoteSize, 0);
+        for (int rank = 0; rank < remoteSize; rank++) {
+          remoteBBs[rank] = emptyBB;
+        }
+        com::CommunicateBoundingBox(masterCom).receiveBoundingBoxMap(remoteBBs, 0);
+      }
+    }
+
+    utils::MasterSlave::_communication->broadcast(remoteSize);
+    com::CommunicateBoundingBox(utils::MasterSlave::_communication).broadcastSendBoundingBoxMap(remoteBBs);
+  }
+  return remoteBBs;
+}
+
+std::vector<int> Partition:: overlappingRanks(const mesh::Mesh::BoundingBox& bb, const mesh::Mesh::BoundingBoxMap& bbm) const{
+  std::vector<int> ranks;
+  for (const auto& rankBB : bbm) {
+    bool overlaps = true;
+    for (size_t d = 0; d < bb.size(); d++) {
+      if (bb[d].first > rankBB.second[d].second || rankBB.second[d].first > bb[d].second) {
+        overlaps = false;
+      }
+    }
+    if (overlaps) {
+      ranks.push_back(rankBB.first);
+    }
+  }
+  return ranks;
+}
 
 }}
@@ -4,6 +4,8 @@
 #include "mapping/SharedPointer.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "m2n/SharedPointer.hpp"
+#include "mesh/Mesh.hpp"
+#include <vector>
 
 
 // ----------------------------------------------------------- CLASS DEFINITION
@@ -69,6 +71,20 @@ protected:
   /// Generate vertex offsets from the vertexDistribution, broadcast it to all slaves
   void computeVertexOffsets();
 
+  /**
+   * @brief Exchanges the bounding boxes of all ranks of both participants through the masters.
+   *
+   * Used if the mesh is exchanged directly between the ranks, see m2n::M2N::usesTwoLevelInitialization().
+   *
+   * @param[in] bb Bounding box of this rank.
+   * @param[in] sendFirst Whether the master first sends or first receives, has to differ between both participants.
+   * @return The bounding boxes of all remote ranks.
+   */
+  mesh::Mesh::BoundingBoxMap exchangeBoundingBoxes(const mesh::Mesh::BoundingBox& bb, bool sendFirst);
+
+  /// Returns all ranks whose bounding boxes in bbm overlap with bb.
+  std::vector<int> overlappingRanks(const mesh::Mesh::BoundingBox& bb, const mesh::Mesh::BoundingBoxMap& bbm) const;
+
 private:
 
   logging::Logger _log{"partition::Partition"};
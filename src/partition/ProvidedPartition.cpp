@@ -26,53 +26,88 @@ void ProvidedPartition::communicate()
   //TODO communication to more than one participant
 
   if(_hasToSend){
-    Event e1("gather mesh");
-
-    // Temporary globalMesh such that the master also keeps his local mesh
-    mesh::Mesh globalMesh(_mesh->getName(), _mesh->getDimensions(), _mesh->isFlipNormals());
-
-    if( not utils::MasterSlave::_slaveMode ){
-      globalMesh.addMesh(*_mesh); //add local master mesh to global mesh
+    if (_m2n->usesTwoLevelInitialization()) {
+      sendDirectly();
+      return;
     }
 
-    // Gather Mesh
-    INFO("Gather mesh " << _mesh->getName() );
-    if (utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode ) {
-      if (utils::MasterSlave::_slaveMode) {
-        com::CommunicateMesh(utils::MasterSlave::_communication).sendMesh( *_mesh, 0 );
-      }
-      else{ // Master
-        assertion(utils::MasterSlave::_rank==0);
-        assertion(utils::MasterSlave::_size>1);
-
-        for (int rankSlave = 1; rankSlave < utils::MasterSlave::_size; rankSlave++) {
-          com::CommunicateMesh(utils::MasterSlave::_communication).receiveMesh ( globalMesh, rankSlave);
-          DEBUG("Received sub-mesh, from slave: " << rankSlave <<", global vertexCount: " << globalMesh.vertices().size());
-        }
-      }
+    if (utils::MasterSlave::_slaveMode) {
+      INFO("Gather mesh " << _mesh->getName() );
+      Event e1("gather mesh");
+      com::CommunicateMesh(utils::MasterSlave::_communication).sendMesh( *_mesh, 0 );
+      return;
     }
 
-    //set global index
-    if (not utils::MasterSlave::_slaveMode) {
-      int globalIndex = 0;
-      for(mesh::Vertex& v : globalMesh.vertices()){
+    // The mesh is streamed rank by rank, such that the master never holds the global mesh.
+    INFO("Send global mesh " << _mesh->getName());
+    Event e2("send global mesh");
+    com::PtrCommunication masterCom = _m2n->getMasterCommunication();
+    int numberOfPieces = utils::MasterSlave::_masterMode ? utils::MasterSlave::_size : 1;
+    masterCom->send(numberOfPieces, 0);
+
+    // Temporary piece such that the master also keeps his local mesh
+    mesh::Mesh piece(_mesh->getName(), _mesh->getDimensions(), _mesh->isFlipNormals());
+    piece.addMesh(*_mesh);
+
+    int globalIndex = 0;
+    for (int rank = 0; rank < numberOfPieces; rank++) {
+      if (rank > 0) {
+        piece.clear();
+        com::CommunicateMesh(utils::MasterSlave::_communication).receiveMesh ( piece, rank );
+        DEBUG("Received sub-mesh, from slave: " << rank << ", vertexCount: " << piece.vertices().size());
+      }
+      //set global index
+      for(mesh::Vertex& v : piece.vertices()){
         v.setGlobalIndex(globalIndex);
         globalIndex++;
       }
+      com::CommunicateMesh(masterCom).sendMesh ( piece, 0 );
     }
+    CHECK ( globalIndex > 0, "The provided mesh " << _mesh->getName() << " is invalid (possibly empty).");
+  } //_hasToSend
+}
 
-    e1.stop();
+void ProvidedPartition::sendDirectly()
+{
+  TRACE();
+  CHECK(utils::MasterSlave::_masterMode || utils::MasterSlave::_slaveMode,
+        "A two-level initialization requires both participants to use a master. Mesh " << _mesh->getName()
+        << " cannot be sent directly from a serial participant.");
+  INFO("Send mesh " << _mesh->getName() << " directly to the remote ranks");
+  Event e("send mesh directly");
 
-    // Send (global) Mesh
-    INFO("Send global mesh " << _mesh->getName());
-    Event e2("send global mesh");
-    if (not utils::MasterSlave::_slaveMode) {
-      CHECK ( globalMesh.vertices().size() > 0, "The provided mesh " << globalMesh.getName() << " is invalid (possibly empty).");
-      com::CommunicateMesh(_m2n->getMasterCommunication()).sendMesh ( globalMesh, 0 );
+  // Global indices are numbered in the order of the ranks, in the same way as in compute()
+  int numberOfVertices = _mesh->vertices().size();
+  int globalVertexCounter = 0;
+  if (utils::MasterSlave::_slaveMode) {
+    utils::MasterSlave::_communication->send(numberOfVertices,0);
+    utils::MasterSlave::_communication->receive(globalVertexCounter,0);
+  }
+  else { // Master
+    int vertexCounter = numberOfVertices;
+    for (int rankSlave = 1; rankSlave < utils::MasterSlave::_size; rankSlave++){
+      int numberOfSlaveVertices = -1;
+      utils::MasterSlave::_communication->receive(numberOfSlaveVertices,rankSlave);
+      utils::MasterSlave::_communication->send(vertexCounter,rankSlave);
+      vertexCounter += numberOfSlaveVertices;
     }
-    e2.stop();
+    CHECK ( vertexCounter > 0, "The provided mesh " << _mesh->getName() << " is invalid (possibly empty).");
+    _m2n->getMasterCommunication()->send(vertexCounter, 0);
+  }
+  for(int i=0; i<numberOfVertices; i++){
+    _mesh->vertices()[i].setGlobalIndex(globalVertexCounter+i);
+  }
 
-  } //_hasToSend
+  _mesh->computeBoundingBox();
+  mesh::Mesh::BoundingBoxMap remoteBBs = exchangeBoundingBoxes(_mesh->getBoundingBox(), true);
+  std::vector<int> remoteRanks = overlappingRanks(_mesh->getBoundingBox(), remoteBBs);
+  DEBUG("Send mesh to remote ranks " << remoteRanks);
+
+  _m2n->acceptSlavesPreConnection("Provider" + _mesh->getName(), "Receiver" + _mesh->getName(), _mesh->getID(), remoteRanks);
+  for (int remoteRank : remoteRanks) {
+    _m2n->sendMesh(*_mesh, _mesh->getID(), remoteRank);
+  }
+  _m2n->closeSlavesPreConnection(_mesh->getID());
 }
 
 void ProvidedPartition::compute()
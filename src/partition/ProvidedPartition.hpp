@@ -31,6 +31,9 @@ public:
 
 private:
 
+   /// Sends the mesh of each rank directly to the remote ranks whose bounding boxes overlap.
+   void sendDirectly();
+
    virtual void createOwnerInformation();
 
    logging::Logger _log{"partition::ProvidedPartition"};
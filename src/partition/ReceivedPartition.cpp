@@ -35,10 +35,122 @@ void ReceivedPartition::communicate()
   TRACE();
   INFO("Receive global mesh " << _mesh->getName());
   Event e("receive global mesh");
-  if (not utils::MasterSlave::_slaveMode) {
-    assertion ( _mesh->vertices().size() == 0 );
-    com::CommunicateMesh(_m2n->getMasterCommunication()).receiveMesh ( *_mesh, 0 );
+
+  if (_m2n->usesTwoLevelInitialization()) {
+    receiveDirectly();
+    return;
+  }
+
+  // In master-slave mode, the pre-filter is applied while the pieces of the mesh arrive.
+  _isPreFiltered = _geometricFilter == FILTER_FIRST &&
+                   (utils::MasterSlave::_masterMode || utils::MasterSlave::_slaveMode);
+
+  if (utils::MasterSlave::_slaveMode) {
+    if (_isPreFiltered) {
+      prepareBoundingBox();
+      com::CommunicateMesh(utils::MasterSlave::_communication).sendBoundingBox (_bb, 0);
+      int numberOfPieces = -1;
+      utils::MasterSlave::_communication->receive(numberOfPieces, 0);
+      for (int piece = 0; piece < numberOfPieces; piece++) {
+        com::CommunicateMesh(utils::MasterSlave::_communication).receiveMesh (*_mesh, 0);
+      }
+    }
+    return;
+  }
+
+  assertion ( _mesh->vertices().size() == 0 );
+  com::PtrCommunication masterCom = _m2n->getMasterCommunication();
+  int numberOfPieces = -1;
+  masterCom->receive(numberOfPieces, 0);
+  assertion(numberOfPieces > 0, numberOfPieces);
+
+  if (not _isPreFiltered) {
+    for (int piece = 0; piece < numberOfPieces; piece++) {
+      com::CommunicateMesh(masterCom).receiveMesh ( *_mesh, 0 );
+    }
+    return;
+  }
+
+  assertion(utils::MasterSlave::_rank==0);
+  assertion(utils::MasterSlave::_size>1);
+  INFO("Pre-filter mesh " << _mesh->getName() << " by bounding-box");
+
+  std::vector<mesh::Mesh::BoundingBox> slaveBBs(utils::MasterSlave::_size, _bb);
+  for (int rankSlave = 1; rankSlave < utils::MasterSlave::_size; rankSlave++) {
+    com::CommunicateMesh(utils::MasterSlave::_communication).receiveBoundingBox ( slaveBBs[rankSlave], rankSlave);
+    utils::MasterSlave::_communication->send(numberOfPieces, rankSlave);
+  }
+  prepareBoundingBox();
+  slaveBBs[0] = _bb;
+
+  int globalNumberOfVertices = 0;
+  mesh::Mesh piece("Piece", _dimensions, _mesh->isFlipNormals());
+  for (int i = 0; i < numberOfPieces; i++) {
+    piece.clear();
+    com::CommunicateMesh(masterCom).receiveMesh ( piece, 0 );
+    globalNumberOfVertices += piece.vertices().size();
+
+    for (int rankSlave = 1; rankSlave < utils::MasterSlave::_size; rankSlave++) {
+      _bb = slaveBBs[rankSlave];
+      mesh::Mesh slaveMesh("SlaveMesh", _dimensions, _mesh->isFlipNormals());
+      filterMesh(piece, slaveMesh, true);
+      com::CommunicateMesh(utils::MasterSlave::_communication).sendMesh ( slaveMesh, rankSlave );
+    }
+    _bb = slaveBBs[0];
+    mesh::Mesh filteredMesh("FilteredMesh", _dimensions, _mesh->isFlipNormals());
+    filterMesh(piece, filteredMesh, true);
+    _mesh->addMesh(filteredMesh);
+  }
+  _mesh->setGlobalNumberOfVertices(globalNumberOfVertices);
+  DEBUG("Master mesh after filtering, #vertices " << _mesh->vertices().size());
+}
+
+void ReceivedPartition::receiveDirectly()
+{
+  TRACE();
+  CHECK(utils::MasterSlave::_masterMode || utils::MasterSlave::_slaveMode,
+        "A two-level initialization requires both participants to use a master. Mesh " << _mesh->getName()
+        << " cannot be received directly by a serial participant.");
+  assertion ( _mesh->vertices().size() == 0 );
+
+  // Without a geometric filter, every rank needs the complete mesh.
+  if (_geometricFilter == NO_FILTER) {
+    _bb.assign(_dimensions, std::make_pair(std::numeric_limits<double>::lowest(), std::numeric_limits<double>::max()));
   }
+  else {
+    prepareBoundingBox();
+  }
+
+  int globalNumberOfVertices = -1;
+  if (utils::MasterSlave::_masterMode) {
+    _m2n->getMasterCommunication()->receive(globalNumberOfVertices, 0);
+  }
+
+  mesh::Mesh::BoundingBoxMap remoteBBs = exchangeBoundingBoxes(_bb, false);
+  std::vector<int> remoteRanks = overlappingRanks(_bb, remoteBBs);
+  DEBUG("Receive mesh from remote ranks " << remoteRanks);
+
+  _m2n->requestSlavesPreConnection("Provider" + _mesh->getName(), "Receiver" + _mesh->getName(), _mesh->getID(), remoteRanks);
+  mesh::Mesh piece("Piece", _dimensions, _mesh->isFlipNormals());
+  for (int remoteRank : remoteRanks) {
+    piece.clear();
+    _m2n->receiveMesh(piece, _mesh->getID(), remoteRank);
+    if (_geometricFilter == NO_FILTER) {
+      _mesh->addMesh(piece);
+    }
+    else {
+      mesh::Mesh filteredMesh("FilteredMesh", _dimensions, _mesh->isFlipNormals());
+      filterMesh(piece, filteredMesh, true);
+      _mesh->addMesh(filteredMesh);
+    }
+  }
+  _m2n->closeSlavesPreConnection(_mesh->getID());
+
+  if (utils::MasterSlave::_masterMode) {
+    _mesh->setGlobalNumberOfVertices(globalNumberOfVertices);
+  }
+  _isPreFiltered = true;
+  DEBUG("Mesh after filtering, #vertices " << _mesh->vertices().size());
 }
 
 void ReceivedPartition::compute()
@@ -62,13 +174,19 @@ void ReceivedPartition::compute()
   }
 
   // (0) set global number of vertices before filtering
-  if (utils::MasterSlave::_masterMode) {
+  if (utils::MasterSlave::_masterMode && not _isPreFiltered) {
     _mesh->setGlobalNumberOfVertices(_mesh->vertices().size());
   }
 
   // (1) Bounding-Box-Filter
 
-  if(_geometricFilter == FILTER_FIRST){ //pre-filter-post-filter
+  if(_isPreFiltered){ // already filtered while receiving the mesh
+    _mesh->computeState();
+    if(_geometricFilter != NO_FILTER){
+      checkFilteredMesh(*_mesh);
+    }
+  }
+  else if(_geometricFilter == FILTER_FIRST){ //pre-filter-post-filter
 
     INFO("Pre-filter mesh " << _mesh->getName() << " by bounding-box");
     Event e("pre-filter mesh by bounding box");
@@ -78,17 +196,7 @@ void ReceivedPartition::compute()
       com::CommunicateMesh(utils::MasterSlave::_communication).sendBoundingBox (_bb, 0);
       com::CommunicateMesh(utils::MasterSlave::_communication).receiveMesh (*_mesh, 0);
 
-      if((_fromMapping.use_count()>0 && _fromMapping->getOutputMesh()->vertices().size()>0) ||
-         (_toMapping.use_count()>0 && _toMapping->getInputMesh()->vertices().size()>0)){
-           // this rank has vertices at the coupling interface
-           // then, also the filtered mesh should still have vertices
-        std::string msg = "The re-partitioning completely filtered out the mesh " + _mesh->getName() +" received on this rank at the coupling interface. "
-            "Most probably, the coupling interfaces of your coupled participants do not match geometry-wise. "
-            "Please check your geometry setup again. Small overlaps or gaps are no problem. "
-            "If your geometry setup is correct and if you have very different mesh resolutions on both sides, increasing the safety-factor "
-            "of the decomposition strategy might be necessary.";
-        CHECK(_mesh->vertices().size()>0, msg);
-      }
+      checkFilteredMesh(*_mesh);
 
     }
     else{ // Master
@@ -114,17 +222,7 @@ void ReceivedPartition::compute()
       _mesh->computeState();
       DEBUG("Master mesh after filtering, #vertices " << _mesh->vertices().size());
 
-      if((_fromMapping.use_count()>0 && _fromMapping->getOutputMesh()->vertices().size()>0) ||
-         (_toMapping.use_count()>0 && _toMapping->getInputMesh()->vertices().size()>0)){
-           // this rank has vertices at the coupling interface
-           // then, also the filtered mesh should still have vertices
-        std::string msg = "The re-partitioning completely filtered out the mesh " + _mesh->getName() +" received on this rank at the coupling interface. "
-            "Most probably, the coupling interfaces of your coupled participants do not match geometry-wise. "
-            "Please check your geometry setup again. Small overlaps or gaps are no problem. "
-            "If your geometry setup is correct and if you have very different mesh resolutions on both sides, increasing the safety-factor "
-            "of the decomposition strategy might be necessary.";
-        CHECK(_mesh->vertices().size()>0, msg);
-      }
+      checkFilteredMesh(*_mesh);
 
     }
   }
@@ -152,17 +250,7 @@ void ReceivedPartition::compute()
       mesh::Mesh filteredMesh("FilteredMesh", _dimensions, _mesh->isFlipNormals());
       filterMesh(filteredMesh, true);
 
-      if((_fromMapping.use_count()>0 && _fromMapping->getOutputMesh()->vertices().size()>0) ||
-         (_toMapping.use_count()>0 && _toMapping->getInputMesh()->vertices().size()>0)){
-           // this rank has vertices at the coupling interface
-           // then, also the filtered mesh should still have vertices
-        std::string msg = "The re-partitioning completely filtered out the mesh " + _mesh->getName() +" received on this rank at the coupling interface. "
-            "Most probably, the coupling interfaces of your coupled participants do not match geometry-wise. "
-            "Please check your geometry setup again. Small overlaps or gaps are no problem. "
-            "If your geometry setup is correct and if you have very different mesh resolutions on both sides, increasing the safety-factor "
-            "of the decomposition strategy might be necessary.";
-        CHECK(filteredMesh.vertices().size()>0, msg);
-      }
+      checkFilteredMesh(filteredMesh);
 
       DEBUG("Bounding box filter, filtered from " << _mesh->vertices().size() << " vertices to " << filteredMesh.vertices().size() << " vertices.");
       _mesh->clear();
@@ -246,17 +334,21 @@ void ReceivedPartition::compute()
 }
 
 void ReceivedPartition:: filterMesh(mesh::Mesh& filteredMesh, const bool filterByBB){
+  filterMesh(*_mesh, filteredMesh, filterByBB);
+}
+
+void ReceivedPartition:: filterMesh(mesh::Mesh& sourceMesh, mesh::Mesh& filteredMesh, const bool filterByBB){
   TRACE(filterByBB);
 
-  DEBUG("Bounding mesh. #vertices: " << _mesh->vertices().size()
-               <<", #edges: " << _mesh->edges().size()
-               <<", #triangles: " << _mesh->triangles().size() << ", rank: " << utils::MasterSlave::_rank);
+  DEBUG("Bounding mesh. #vertices: " << sourceMesh.vertices().size()
+               <<", #edges: " << sourceMesh.edges().size()
+               <<", #triangles: " << sourceMesh.triangles().size() << ", rank: " << utils::MasterSlave::_rank);
 
   std::map<int, mesh::Vertex*> vertexMap;
   std::map<int, mesh::Edge*> edgeMap;
   int vertexCounter = 0;
 
-  for (const mesh::Vertex& vertex : _mesh->vertices()) {
+  for (const mesh::Vertex& vertex : sourceMesh.vertices()) {
 
     if ((filterByBB && isVertexInBB(vertex)) || (not filterByBB && vertex.isTagged())){
       mesh::Vertex& v = filteredMesh.createVertex(vertex.getCoords());
@@ -269,7 +361,7 @@ void ReceivedPartition:: filterMesh(mesh::Mesh& filteredMesh, const bool filterB
   }
 
   // Add all edges formed by the contributing vertices
-  for (mesh::Edge& edge : _mesh->edges()) {
+  for (mesh::Edge& edge : sourceMesh.edges()) {
     int vertexIndex1 = edge.vertex(0).getID();
     int vertexIndex2 = edge.vertex(1).getID();
     if (utils::contained(vertexIndex1, vertexMap) &&
@@ -281,7 +373,7 @@ void ReceivedPartition:: filterMesh(mesh::Mesh& filteredMesh, const bool filterB
 
   // Add all triangles formed by the contributing edges
   if (_dimensions==3) {
-    for (mesh::Triangle& triangle : _mesh->triangles() ) {
+    for (mesh::Triangle& triangle : sourceMesh.triangles() ) {
       int edgeIndex1 = triangle.edge(0).getID();
       int edgeIndex2 = triangle.edge(1).getID();
       int edgeIndex3 = triangle.edge(2).getID();
@@ -298,13 +390,28 @@ void ReceivedPartition:: filterMesh(mesh::Mesh& filteredMesh, const bool filterB
                <<", #triangles: " << filteredMesh.triangles().size() << ", rank: " << utils::MasterSlave::_rank);
 }
 
+void ReceivedPartition::checkFilteredMesh(const mesh::Mesh& filteredMesh){
+  if((_fromMapping.use_count()>0 && _fromMapping->getOutputMesh()->vertices().size()>0) ||
+     (_toMapping.use_count()>0 && _toMapping->getInputMesh()->vertices().size()>0)){
+       // this rank has vertices at the coupling interface
+       // then, also the filtered mesh should still have vertices
+    std::string msg = "The re-partitioning completely filtered out the mesh " + _mesh->getName() +" received on this rank at the coupling interface. "
+        "Most probably, the coupling interfaces of your coupled participants do not match geometry-wise. "
+        "Please check your geometry setup again. Small overlaps or gaps are no problem. "
+        "If your geometry setup is correct and if you have very different mesh resolutions on both sides, increasing the safety-factor "
+        "of the decomposition strategy might be necessary.";
+    CHECK(filteredMesh.vertices().size()>0, msg);
+  }
+}
+
 void ReceivedPartition::prepareBoundingBox(){
   TRACE(_safetyFactor);
 
   _bb.resize(_dimensions, std::make_pair(std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest()));
 
-  //create BB around both "other" meshes
+  //create BB around both "other" meshes, whose state might not be computed yet if called from communicate()
   if (_fromMapping.use_count()>0) {
+    _fromMapping->getOutputMesh()->computeBoundingBox();
     auto other_bb = _fromMapping->getOutputMesh()->getBoundingBox();
     for (int d=0; d < _dimensions; d++) {
       if (_bb[d].first > other_bb[d].first) _bb[d].first = other_bb[d].first;
@@ -312,6 +419,7 @@ void ReceivedPartition::prepareBoundingBox(){
     }
   }
   if (_toMapping.use_count()>0) {
+    _toMapping->getInputMesh()->computeBoundingBox();
     auto other_bb = _toMapping->getInputMesh()->getBoundingBox();
     for (int d=0; d<_dimensions; d++) {
       if (_bb[d].first > other_bb[d].first) _bb[d].first = other_bb[d].first;
@@ -37,7 +37,13 @@ public:
 
    virtual ~ReceivedPartition() {}
 
-   /// The mesh is received from another participant.
+   /**
+    * @brief The mesh is received from another participant.
+    *
+    * With FILTER_FIRST in master-slave mode, the master filters each arriving piece against the
+    * bounding boxes of all ranks and forwards it, such that it never holds the global mesh.
+    * With a two-level initialization, every rank receives its piece directly, see receiveDirectly().
+    */
    virtual void communicate ();
 
    /// The mesh is re-partitioned and all distribution data structures are set up.
@@ -45,8 +51,17 @@ public:
 
 private:
 
+   /// Receives the mesh directly from the remote ranks whose bounding boxes overlap and filters it.
+   void receiveDirectly();
+
+   /// Checks that the filtered mesh is not empty if this rank has vertices at the coupling interface.
+   void checkFilteredMesh(const mesh::Mesh& filteredMesh);
+
    void filterMesh(mesh::Mesh& filteredMesh, const bool filterByBB);
 
+   /// Adds all vertices of sourceMesh inside the bounding box (or tagged ones) and their connectivity to filteredMesh.
+   void filterMesh(mesh::Mesh& sourceMesh, mesh::Mesh& filteredMesh, const bool filterByBB);
+
    void prepareBoundingBox();
 
    bool isVertexInBB(const mesh::Vertex& vertex);
@@ -64,6 +79,9 @@ private:
 
    double _safetyFactor;
 
+   /// True if the bounding-box filter was already applied while receiving the mesh in communicate().
+   bool _isPreFiltered = false;
+
    logging::Logger _log{"partition::ReceivedPartition"};
 
 };
@@ -12,6 +12,8 @@
 #include "m2n/M2N.hpp"
 #include "utils/MasterSlave.hpp"
 #include "m2n/GatherScatterComFactory.hpp"
+#include "m2n/PointToPointComFactory.hpp"
+#include "com/SocketCommunicationFactory.hpp"
 #include "mapping/SharedPointer.hpp"
 #include "mapping/NearestProjectionMapping.hpp"
 #include "mapping/NearestNeighborMapping.hpp"
@@ -984,6 +986,101 @@ BOOST_FIXTURE_TEST_CASE(ProvideAndReceiveCouplingMode, testing::M2NFixture,
   }
 }
 
+BOOST_AUTO_TEST_CASE(TwoLevelInitialization2D, * testing::OnSize(4))
+{
+  com::PtrCommunication participantCom = com::PtrCommunication(new com::MPIDirectCommunication());
+  m2n::DistributedComFactory::SharedPointer distrFactory = m2n::DistributedComFactory::SharedPointer(
+      new m2n::PointToPointComFactory(com::PtrCommunicationFactory(new com::SocketCommunicationFactory())));
+  bool useTwoLevelInit = true;
+  m2n::PtrM2N m2n = m2n::PtrM2N(new m2n::M2N(participantCom, distrFactory, useTwoLevelInit));
+
+  com::PtrCommunication masterSlaveCom = com::PtrCommunication(new com::MPIDirectCommunication());
+  utils::MasterSlave::_communication = masterSlaveCom;
+  utils::MasterSlave::_size = 2;
+  utils::MasterSlave::_rank = utils::Parallel::getProcessRank() % 2;
+  utils::MasterSlave::_masterMode = utils::MasterSlave::_rank == 0;
+  utils::MasterSlave::_slaveMode = utils::MasterSlave::_rank == 1;
+
+  bool isProvider = utils::Parallel::getProcessRank() < 2;
+  std::string participant = isProvider ? "Solid" : "Fluid";
+  if (utils::MasterSlave::_masterMode) {
+    utils::Parallel::splitCommunicator( participant + "Master" );
+    masterSlaveCom->acceptConnection ( participant + "Master", participant + "Slaves");
+    masterSlaveCom->setRankOffset(1);
+  }
+  else {
+    utils::Parallel::splitCommunicator( participant + "Slaves" );
+    masterSlaveCom->requestConnection( participant + "Master", participant + "Slaves", 0, 1 );
+  }
+
+  if (isProvider) {
+    m2n->acceptMasterConnection ( "SolidMaster", "FluidMaster");
+  }
+  else {
+    m2n->requestMasterConnection ( "SolidMaster", "FluidMaster");
+  }
+
+  int dimensions = 2;
+  bool flipNormals = false;
+  Eigen::VectorXd position(dimensions);
+
+  if (isProvider) {
+    mesh::PtrMesh pSolidzMesh(new mesh::Mesh("SolidzMesh", dimensions, flipNormals));
+    m2n->createDistributedCommunication(pSolidzMesh);
+    double offset = utils::MasterSlave::_rank == 0 ? 0.0 : 4.5;
+    position << 0.0, offset;
+    mesh::Vertex& v1 = pSolidzMesh->createVertex(position);
+    position << 0.0, offset + 1.0;
+    mesh::Vertex& v2 = pSolidzMesh->createVertex(position);
+    position << 0.0, offset + 1.5;
+    mesh::Vertex& v3 = pSolidzMesh->createVertex(position);
+    pSolidzMesh->createEdge(v1,v2);
+    pSolidzMesh->createEdge(v2,v3);
+
+    bool hasToSend = true;
+    ProvidedPartition part(pSolidzMesh, hasToSend);
+    part.setm2n(m2n);
+    part.communicate();
+    part.compute();
+
+    BOOST_TEST(pSolidzMesh->getGlobalNumberOfVertices() == 6);
+    BOOST_TEST(pSolidzMesh->vertices()[0].getGlobalIndex() == 3 * utils::MasterSlave::_rank);
+  }
+  else {
+    mesh::PtrMesh pNastinMesh(new mesh::Mesh("NastinMesh", dimensions, flipNormals));
+    mesh::PtrMesh pSolidzMesh(new mesh::Mesh("SolidzMesh", dimensions, flipNormals));
+    m2n->createDistributedCommunication(pSolidzMesh);
+
+    mapping::PtrMapping boundingFromMapping = mapping::PtrMapping (
+        new mapping::NearestNeighborMapping(mapping::Mapping::CONSISTENT, dimensions) );
+    boundingFromMapping->setMeshes(pSolidzMesh,pNastinMesh);
+
+    // Each receiving rank only overlaps with the providing rank of the same rank.
+    double offset = utils::MasterSlave::_rank == 0 ? 0.0 : 4.5;
+    position << 0.0, offset + 0.1;
+    pNastinMesh->createVertex(position);
+    position << 0.0, offset + 1.4;
+    pNastinMesh->createVertex(position);
+
+    double safetyFactor = 0.1;
+    ReceivedPartition part(pSolidzMesh, ReceivedPartition::FILTER_FIRST, safetyFactor);
+    part.setm2n(m2n);
+    part.setFromMapping(boundingFromMapping);
+    part.communicate();
+
+    // The bounding box of y in [offset - 0.03, offset + 1.53] contains all three vertices.
+    BOOST_TEST(pSolidzMesh->vertices().size() == 3);
+    BOOST_TEST(pSolidzMesh->edges().size() == 2);
+    BOOST_TEST(pSolidzMesh->vertices()[0].getGlobalIndex() == 3 * utils::MasterSlave::_rank);
+    BOOST_TEST(pSolidzMesh->vertices()[2].getCoords()[1] == offset + 1.5);
+
+    part.compute();
+    BOOST_TEST(pSolidzMesh->getGlobalNumberOfVertices() == 6);
+  }
+
+  tearDownParallelEnvironment();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 
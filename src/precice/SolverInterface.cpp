@@ -39,6 +39,18 @@ double SolverInterface:: advance
   return _impl->advance ( computedTimestepLength );
 }
 
+void SolverInterface:: startAdvance
+(
+  double computedTimestepLength )
+{
+  _impl->startAdvance ( computedTimestepLength );
+}
+
+double SolverInterface:: finishAdvance()
+{
+  return _impl->finishAdvance();
+}
+
 void SolverInterface:: finalize()
 {
   return _impl->finalize();
@@ -32,12 +32,14 @@ namespace PreciceTests {
     struct TestConfiguration;
     struct testExplicitWithSubcycling;
     struct testExplicitWithDataExchange;
+    struct testExplicitWithAsyncAdvance;
     struct testExplicitWithDataInitialization;
     struct testExplicitWithBlockDataExchange;
     struct testExplicitWithSolverGeometry;
     struct testExplicitWithDisplacingGeometry;
     struct testExplicitWithDataScaling;
     struct testImplicit;
+    struct testImplicitWithAsyncAdvance;
     struct testStationaryMappingWithSolverMesh;
     struct testBug;
     struct testThreeSolvers;
@@ -174,6 +176,45 @@ public:
    */
   double advance ( double computedTimestepLength );
 
+  /**
+   * @brief Starts advancing preCICE in the background and returns immediately.
+   *
+   * Does the same as advance(), but on a separate progress thread, such that the
+   * solver can overlap work not depending on coupling data, e.g., the assembly of
+   * the next timestep, with mapping and communication. This pays off in explicit
+   * coupling schemes and for the first participant of serial coupling schemes.
+   * finishAdvance() has to be called to complete the advance.
+   *
+   * Between startAdvance() and finishAdvance():
+   * - No other method of the interface must be called, except finishAdvance().
+   *   Calling any other method stops with an error.
+   * - The solver may modify its own buffers freely, as written data has been
+   *   copied into preCICE before, and read data is only copied out after
+   *   finishAdvance().
+   * - If the solver calls MPI itself, MPI has to provide MPI_THREAD_MULTIPLE.
+   *   Otherwise, MPI_THREAD_SERIALIZED suffices, which preCICE requests if it
+   *   initializes MPI.
+   *
+   * Preconditions:
+   * - Same as for advance().
+   *
+   * @param computedTimestepLength [IN] Length of timestep computed by solver.
+   */
+  void startAdvance ( double computedTimestepLength );
+
+  /**
+   * @brief Waits for the advance started by startAdvance() to complete.
+   *
+   * Preconditions:
+   * - startAdvance() has been called.
+   *
+   * Postconditions:
+   * - Same as for advance(), i.e., new read data is available.
+   *
+   * @return Maximum length of next timestep to be computed by solver.
+   */
+  double finishAdvance();
+
   /**
    * @brief Finalizes preCICE.
    *
@@ -589,12 +630,14 @@ private:
   friend struct PreciceTests::Serial::TestConfiguration;
   friend struct PreciceTests::Serial::testExplicitWithSubcycling;
   friend struct PreciceTests::Serial::testExplicitWithDataExchange;
+  friend struct PreciceTests::Serial::testExplicitWithAsyncAdvance;
   friend struct PreciceTests::Serial::testExplicitWithDataInitialization;
   friend struct PreciceTests::Serial::testExplicitWithBlockDataExchange;
   friend struct PreciceTests::Serial::testExplicitWithSolverGeometry;
   friend struct PreciceTests::Serial::testExplicitWithDisplacingGeometry;
   friend struct PreciceTests::Serial::testExplicitWithDataScaling;
   friend struct PreciceTests::Serial::testImplicit;
+  friend struct PreciceTests::Serial::testImplicitWithAsyncAdvance;
   friend struct PreciceTests::Serial::testStationaryMappingWithSolverMesh;
   friend struct PreciceTests::Serial::testBug;
   friend struct PreciceTests::Serial::testThreeSolvers;
@@ -42,6 +42,20 @@ void precicec_initialize_data();
  */
 double precicec_advance ( double computedTimestepLength );
 
+/**
+ * @brief Starts advancing in the background, see precice::SolverInterface::startAdvance().
+ *
+ * @param computedTimestepLength [IN] Length of timestep computed by solver.
+ */
+void precicec_startAdvance ( double computedTimestepLength );
+
+/**
+ * @brief Completes the advance started by precicec_startAdvance().
+ *
+ * @return Maximal length of next timestep to be computed by solver.
+ */
+double precicec_finishAdvance();
+
 /**
  * @brief Finalizes the coupling to the coupling supervisor.
  */
@@ -41,6 +41,7 @@ ParticipantConfiguration:: ParticipantConfiguration
   TAG_SERVER("server"),
   TAG_MASTER("master"),
   ATTR_NAME("name"),
+  ATTR_THREADS("threads"),
   ATTR_SOURCE_DATA("source-data"),
   ATTR_TARGET_DATA("target-data"),
   ATTR_TIMING("timing"),
@@ -81,6 +82,13 @@ ParticipantConfiguration:: ParticipantConfiguration
   attrName.setDocumentation(doc);
   tag.addAttribute(attrName);
 
+  XMLAttribute<int> attrThreads(ATTR_THREADS);
+  doc = "Number of threads per process used for element-wise operations on the coupling data, ";
+  doc += "e.g., in the quasi-Newton post-processing. The default is \"1\", i.e., no additional threads.";
+  attrThreads.setDocumentation(doc);
+  attrThreads.setDefaultValue(1);
+  tag.addAttribute(attrThreads);
+
   XMLTag tagWriteData(*this, TAG_WRITE, XMLTag::OCCUR_ARBITRARY);
   doc = "Sets data to be written by the participant to preCICE. ";
   doc += "Data is defined by using the <data> tag.";
@@ -347,6 +355,13 @@ void ParticipantConfiguration:: xmlTagCallback
   if (tag.getName() == TAG){
     std::string name = tag.getStringAttributeValue(ATTR_NAME);
     impl::PtrParticipant p(new impl::Participant(name, _meshConfig));
+    int threads = tag.getIntAttributeValue(ATTR_THREADS);
+    if (threads < 1){
+      std::ostringstream stream;
+      stream << "Participant \"" << name << "\" needs at least one thread";
+      throw stream.str();
+    }
+    p->setThreadCount(threads);
     _participants.push_back(p);
   }
   else if (tag.getName() == TAG_USE_MESH){
@@ -419,6 +434,7 @@ void ParticipantConfiguration:: xmlTagCallback
     utils::MasterSlave::_communication = com;
 
     _participants.back()->setUseMaster(true);
+    _participants.back()->setMasterSlaveTreeFactory(comConfig.createCommunicationFactory(tag));
   }
 }
 
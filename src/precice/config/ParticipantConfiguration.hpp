@@ -86,6 +86,7 @@ private:
   const std::string TAG_MASTER;
 
   const std::string ATTR_NAME;
+  const std::string ATTR_THREADS;
   const std::string ATTR_SOURCE_DATA;
   const std::string ATTR_TARGET_DATA;
   const std::string ATTR_TIMING;
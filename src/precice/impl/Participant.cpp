@@ -37,7 +37,9 @@ Participant:: Participant
   _writeDataContexts (),
   _readDataContexts (),
   _clientServerCommunication (),
-  _useMaster(false)
+  _useMaster(false),
+  _masterSlaveTreeFactory(),
+  _threadCount(1)
 {
   _participantsSize ++;
 }
@@ -328,5 +330,30 @@ void Participant:: setUseMaster(bool useMaster)
   _useMaster = useMaster;
 }
 
+void Participant:: setMasterSlaveTreeFactory
+(
+  com::PtrCommunicationFactory factory )
+{
+  _masterSlaveTreeFactory = factory;
+}
+
+com::PtrCommunicationFactory Participant:: getMasterSlaveTreeFactory() const
+{
+  return _masterSlaveTreeFactory;
+}
+
+void Participant:: setThreadCount
+(
+  int threadCount )
+{
+  assertion(threadCount > 0, threadCount);
+  _threadCount = threadCount;
+}
+
+int Participant:: getThreadCount() const
+{
+  return _threadCount;
+}
+
 
 }} // namespace precice, impl
@@ -8,6 +8,7 @@
 #include "io/config/ExportConfiguration.hpp"
 #include "io/ExportContext.hpp"
 #include "cplscheme/SharedPointer.hpp"
+#include "com/SharedPointer.hpp"
 #include "logging/Logger.hpp"
 #include "utils/PointerVector.hpp"
 #include "partition/ReceivedPartition.hpp"
@@ -141,6 +142,17 @@ public:
 
   void setUseMaster(bool useMaster);
 
+  /// Sets the factory for the tree connecting master and slaves, see com::Communication::connectTree().
+  void setMasterSlaveTreeFactory ( com::PtrCommunicationFactory factory );
+
+  /// Returns nullptr, if the master-slave communication has native collectives.
+  com::PtrCommunicationFactory getMasterSlaveTreeFactory() const;
+
+  /// Sets the number of threads per process, see utils::ThreadPool.
+  void setThreadCount ( int threadCount );
+
+  int getThreadCount() const;
+
   /**
    * @brief Returns true, if the
    */
@@ -189,6 +201,10 @@ private:
 
   bool _useMaster;
 
+  com::PtrCommunicationFactory _masterSlaveTreeFactory;
+
+  int _threadCount;
+
   template<typename ELEMENT_T>
   bool isDataValid (
     const std::vector<ELEMENT_T>& data,
@@ -16,6 +16,7 @@
 #include "mesh/Merge.hpp"
 #include "io/ExportContext.hpp"
 #include "io/Export.hpp"
+#include "com/CommunicationFactory.hpp"
 #include "com/MPIPortsCommunication.hpp"
 #include "com/MPIDirectCommunication.hpp"
 #include "m2n/config/M2NConfiguration.hpp"
@@ -27,6 +28,7 @@
 #include "utils/Helpers.hpp"
 #include "utils/SignalHandler.hpp"
 #include "utils/Parallel.hpp"
+#include "utils/ThreadPool.hpp"
 #include "utils/Petsc.hpp"
 #include "utils/MasterSlave.hpp"
 #include "mapping/Mapping.hpp"
@@ -72,6 +74,9 @@ SolverInterfaceImpl:: SolverInterfaceImpl
   _m2ns(),
   _participants(),
   _numberAdvanceCalls(0),
+  _advanceThread(),
+  _isAdvancing(false),
+  _advanceResult(0.0),
   _requestManager(nullptr)
 {
   CHECK(_accessorProcessRank >= 0, "Accessor process index has to be >= 0!");
@@ -95,6 +100,9 @@ SolverInterfaceImpl:: SolverInterfaceImpl
 SolverInterfaceImpl:: ~SolverInterfaceImpl()
 {
   TRACE();
+  if (_advanceThread.joinable()){
+    _advanceThread.join();
+  }
   if (_requestManager != nullptr){
     delete _requestManager;
   }
@@ -104,6 +112,7 @@ void SolverInterfaceImpl:: configure
 (
   const std::string& configurationFileName )
 {
+  checkNotAdvancing("configure()");
   mesh::Mesh::resetGeometryIDsGlobally();
   mesh::Data::resetDataCount();
   Participant::resetParticipantCount();
@@ -121,6 +130,7 @@ void SolverInterfaceImpl:: configure
   const config::SolverInterfaceConfiguration& config )
 {
   TRACE();
+  checkNotAdvancing("configure()");
   _dimensions = config.getDimensions();
   _accessor = determineAccessingParticipant(config);
 
@@ -134,6 +144,8 @@ void SolverInterfaceImpl:: configure
     utils::MasterSlave::configure(_accessorProcessRank, _accessorCommunicatorSize);
   }
 
+  utils::ThreadPool::getInstance().setSize(_accessor->getThreadCount());
+
   _participants = config.getParticipantConfiguration()->getParticipants();
   configureM2Ns(config.getM2NConfiguration());
 
@@ -194,6 +206,7 @@ void SolverInterfaceImpl:: configure
 double SolverInterfaceImpl:: initialize()
 {
   TRACE();
+  checkNotAdvancing("initialize()");
   Event e("initialize", not precice::testMode);
 
   m2n::PointToPointCommunication::ScopedSetEventNamePrefix ssenp(
@@ -282,6 +295,7 @@ double SolverInterfaceImpl:: initialize()
 void SolverInterfaceImpl:: initializeData ()
 {
   TRACE();
+  checkNotAdvancing("initializeData()");
   Event e("initializeData", not precice::testMode);
 
   m2n::PointToPointCommunication::ScopedSetEventNamePrefix ssenp(
@@ -309,7 +323,7 @@ void SolverInterfaceImpl:: initializeData ()
       if (context.timestepInterval != -1){
         std::ostringstream suffix;
         suffix << _accessorName << ".init";
-        exportMesh(suffix.str());
+        performExport(suffix.str(), constants::exportAll());
         if (context.triggerSolverPlot){
           _couplingScheme->requireAction(constants::actionPlotOutput());
         }
@@ -319,6 +333,42 @@ void SolverInterfaceImpl:: initializeData ()
 }
 
 double SolverInterfaceImpl:: advance
+(
+  double computedTimestepLength )
+{
+  TRACE(computedTimestepLength);
+  checkNotAdvancing("advance()");
+  return performAdvance(computedTimestepLength);
+}
+
+void SolverInterfaceImpl:: startAdvance
+(
+  double computedTimestepLength )
+{
+  TRACE(computedTimestepLength);
+  checkNotAdvancing("startAdvance()");
+  CHECK(_couplingScheme->isInitialized(), "initialize() has to be called before startAdvance()");
+  if (not utils::Parallel::isThreadSerialized()){
+    WARN("MPI is not initialized with MPI_THREAD_SERIALIZED or higher. "
+         << "Communicating via MPI from the progress thread of startAdvance() may fail.");
+  }
+  _isAdvancing = true;
+  // The progress thread is the only one to access preCICE until finishAdvance() joins it
+  _advanceThread = std::thread([this, computedTimestepLength](){
+    _advanceResult = performAdvance(computedTimestepLength);
+  });
+}
+
+double SolverInterfaceImpl:: finishAdvance()
+{
+  TRACE();
+  CHECK(_isAdvancing, "startAdvance() has to be called before finishAdvance()");
+  _advanceThread.join();
+  _isAdvancing = false;
+  return _advanceResult;
+}
+
+double SolverInterfaceImpl:: performAdvance
 (
   double computedTimestepLength )
 {
@@ -403,6 +453,7 @@ double SolverInterfaceImpl:: advance
 void SolverInterfaceImpl:: finalize()
 {
   TRACE();
+  checkNotAdvancing("finalize()");
   CHECK(_couplingScheme->isInitialized(), "initialize() has to be called before finalize()");
   _couplingScheme->finalize();
   _couplingScheme.reset();
@@ -416,7 +467,7 @@ void SolverInterfaceImpl:: finalize()
       if ( context.timestepInterval != -1 ){
         std::ostringstream suffix;
         suffix << _accessorName << ".final";
-        exportMesh ( suffix.str() );
+        performExport(suffix.str(), constants::exportAll());
         if ( context.triggerSolverPlot ) {
           _couplingScheme->requireAction ( constants::actionPlotOutput() );
         }
@@ -445,9 +496,13 @@ void SolverInterfaceImpl:: finalize()
     }
   }
   if(utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode){
+    utils::MasterSlave::_communication->closeRing();
+    utils::MasterSlave::_communication->closeTree();
     utils::MasterSlave::_communication->closeConnection();
     utils::MasterSlave::_communication = nullptr;
+    utils::MasterSlave::_communicationFactory = nullptr;
   }
+  utils::ThreadPool::getInstance().setSize(1);
 
   if(_serverMode){
     _accessor->getClientServerCommunication()->closeConnection();
@@ -470,18 +525,21 @@ void SolverInterfaceImpl:: finalize()
 int SolverInterfaceImpl:: getDimensions() const
 {
   TRACE(_dimensions );
+  checkNotAdvancing("getDimensions()");
   return _dimensions;
 }
 
 bool SolverInterfaceImpl:: isCouplingOngoing()
 {
   TRACE();
+  checkNotAdvancing("isCouplingOngoing()");
   return _couplingScheme->isCouplingOngoing();
 }
 
 bool SolverInterfaceImpl:: isReadDataAvailable()
 {
   TRACE();
+  checkNotAdvancing("isReadDataAvailable()");
   return _couplingScheme->hasDataBeenExchanged();
 }
 
@@ -490,12 +548,14 @@ bool SolverInterfaceImpl:: isWriteDataRequired
   double computedTimestepLength )
 {
   TRACE(computedTimestepLength);
+  checkNotAdvancing("isWriteDataRequired()");
   return _couplingScheme->willDataBeExchanged(computedTimestepLength);
 }
 
 bool SolverInterfaceImpl:: isTimestepComplete()
 {
   TRACE();
+  checkNotAdvancing("isTimestepComplete()");
   return _couplingScheme->isCouplingTimestepComplete();
 }
 
@@ -503,6 +563,7 @@ bool SolverInterfaceImpl:: isActionRequired
 (
   const std::string& action )
 {
+  checkNotAdvancing("isActionRequired()");
   TRACE(action, _couplingScheme->isActionRequired(action));
   return _couplingScheme->isActionRequired(action);
 }
@@ -512,6 +573,7 @@ void SolverInterfaceImpl:: fulfilledAction
   const std::string& action )
 {
   TRACE(action);
+  checkNotAdvancing("fulfilledAction()");
   if ( _clientMode ) {
     _requestManager->requestFulfilledAction(action);
   }
@@ -520,12 +582,14 @@ void SolverInterfaceImpl:: fulfilledAction
 
 bool SolverInterfaceImpl::hasToEvaluateSurrogateModel()
 {
+  checkNotAdvancing("hasToEvaluateSurrogateModel()");
  // std::cout<<"_isCoarseModelOptimizationActive() = "<<_couplingScheme->isCoarseModelOptimizationActive();
   return _couplingScheme->isCoarseModelOptimizationActive();
 }
 
 bool SolverInterfaceImpl::hasToEvaluateFineModel()
 {
+  checkNotAdvancing("hasToEvaluateFineModel()");
   return not _couplingScheme->isCoarseModelOptimizationActive();
 }
 
@@ -534,6 +598,7 @@ bool SolverInterfaceImpl:: hasMesh
   const std::string& meshName ) const
 {
   TRACE(meshName);
+  checkNotAdvancing("hasMesh()");
   return utils::contained ( meshName, _meshIDs );
 }
 
@@ -542,6 +607,7 @@ int SolverInterfaceImpl:: getMeshID
   const std::string& meshName )
 {
   TRACE(meshName);
+  checkNotAdvancing("getMeshID()");
   CHECK( utils::contained(meshName, _meshIDs), "Mesh with name \""<< meshName << "\" is not defined!" );
   return _meshIDs[meshName];
 }
@@ -549,6 +615,7 @@ int SolverInterfaceImpl:: getMeshID
 std::set<int> SolverInterfaceImpl:: getMeshIDs()
 {
   TRACE();
+  checkNotAdvancing("getMeshIDs()");
   std::set<int> ids;
   for (const impl::MeshContext* context : _accessor->usedMeshContexts()) {
     ids.insert ( context->mesh->getID() );
@@ -561,6 +628,7 @@ bool SolverInterfaceImpl:: hasData
   const std::string& dataName, int meshID )
 {
   TRACE(dataName, meshID );
+  checkNotAdvancing("hasData()");
   CHECK(_dataIDs.find(meshID)!=_dataIDs.end(), "No mesh with meshID \"" << meshID << "\" is defined");
   std::map<std::string,int>& sub_dataIDs =  _dataIDs[meshID];
   return sub_dataIDs.find(dataName)!= sub_dataIDs.end();
@@ -571,6 +639,7 @@ int SolverInterfaceImpl:: getDataID
   const std::string& dataName, int meshID )
 {
   TRACE(dataName, meshID );
+  checkNotAdvancing("getDataID()");
   CHECK(hasData(dataName, meshID),
         "Data with name \"" << dataName << "\" is not defined on mesh with ID \"" << meshID << "\".");
   return _dataIDs[meshID][dataName];
@@ -581,6 +650,7 @@ int SolverInterfaceImpl:: getMeshVertexSize
   int meshID )
 {
   TRACE(meshID);
+  checkNotAdvancing("getMeshVertexSize()");
   int size = 0;
   if (_clientMode){
     size = _requestManager->requestGetMeshVertexSize(meshID);
@@ -600,6 +670,7 @@ void SolverInterfaceImpl:: resetMesh
   int meshID )
 {
   TRACE(meshID);
+  checkNotAdvancing("resetMesh()");
   if (_clientMode){
     _requestManager->requestResetMesh(meshID);
   }
@@ -625,6 +696,7 @@ int SolverInterfaceImpl:: setMeshVertex
   const double* position )
 {
   TRACE(meshID);
+  checkNotAdvancing("setMeshVertex()");
   Eigen::VectorXd internalPosition(_dimensions);
   for ( int dim=0; dim < _dimensions; dim++ ){
     internalPosition[dim] = position[dim];
@@ -656,6 +728,7 @@ void SolverInterfaceImpl:: setMeshVertices
   int*    ids )
 {
   TRACE(meshID, size);
+  checkNotAdvancing("setMeshVertices()");
   if (_clientMode){
     _requestManager->requestSetMeshVertices(meshID, size, positions, ids);
   }
@@ -685,6 +758,7 @@ void SolverInterfaceImpl:: getMeshVertices
   double* positions )
 {
   TRACE(meshID, size);
+  checkNotAdvancing("getMeshVertices()");
   if (_clientMode){
     _requestManager->requestGetMeshVertices(meshID, size, ids, positions);
   }
@@ -712,6 +786,7 @@ void SolverInterfaceImpl:: getMeshVertexIDsFromPositions (
   int*    ids )
 {
   TRACE(meshID, size);
+  checkNotAdvancing("getMeshVertexIDsFromPositions()");
   if (_clientMode){
     _requestManager->requestGetMeshVertexIDsFromPositions(meshID, size, positions, ids);
   }
@@ -748,6 +823,7 @@ int SolverInterfaceImpl:: setMeshEdge
   int secondVertexID )
 {
   TRACE(meshID, firstVertexID, secondVertexID );
+  checkNotAdvancing("setMeshEdge()");
   if ( _clientMode ){
     return _requestManager->requestSetMeshEdge ( meshID, firstVertexID, secondVertexID );
   }
@@ -780,6 +856,7 @@ void SolverInterfaceImpl:: setMeshTriangle
 {
   TRACE(meshID, firstEdgeID,
                   secondEdgeID, thirdEdgeID );
+  checkNotAdvancing("setMeshTriangle()");
   if ( _clientMode ){
     _requestManager->requestSetMeshTriangle ( meshID, firstEdgeID, secondEdgeID, thirdEdgeID );
   }
@@ -811,6 +888,7 @@ void SolverInterfaceImpl:: setMeshTriangleWithEdges
 {
   TRACE(meshID, firstVertexID,
                 secondVertexID, thirdVertexID);
+  checkNotAdvancing("setMeshTriangleWithEdges()");
   if (_clientMode){
     _requestManager->requestSetMeshTriangleWithEdges(meshID,
                                                      firstVertexID,
@@ -907,6 +985,7 @@ void SolverInterfaceImpl:: setMeshQuad
 {
   TRACE(meshID, firstEdgeID, secondEdgeID, thirdEdgeID,
                 fourthEdgeID);
+  checkNotAdvancing("setMeshQuad()");
   if (_clientMode){
     _requestManager->requestSetMeshQuad(meshID, firstEdgeID, secondEdgeID,
                                         thirdEdgeID, fourthEdgeID);
@@ -943,6 +1022,7 @@ void SolverInterfaceImpl:: setMeshQuadWithEdges
 {
   TRACE(meshID, firstVertexID,
                 secondVertexID, thirdVertexID, fourthVertexID);
+  checkNotAdvancing("setMeshQuadWithEdges()");
   if (_clientMode){
     _requestManager->requestSetMeshQuadWithEdges(
         meshID, firstVertexID, secondVertexID, thirdVertexID, fourthVertexID);
@@ -1054,6 +1134,7 @@ void SolverInterfaceImpl:: mapWriteDataFrom
   int fromMeshID )
 {
   TRACE(fromMeshID);
+  checkNotAdvancing("mapWriteDataFrom()");
   if (_clientMode){
     _requestManager->requestMapWriteDataFrom(fromMeshID);
     return;
@@ -1090,6 +1171,7 @@ void SolverInterfaceImpl:: mapReadDataTo
   int toMeshID )
 {
   TRACE(toMeshID);
+  checkNotAdvancing("mapReadDataTo()");
   if (_clientMode){
     _requestManager->requestMapReadDataTo(toMeshID);
     return;
@@ -1136,6 +1218,7 @@ void SolverInterfaceImpl:: writeBlockVectorData
   double* values )
 {
   TRACE(fromDataID, size);
+  checkNotAdvancing("writeBlockVectorData()");
   if (size == 0)
     return;
   assertion(valueIndices != nullptr);
@@ -1169,6 +1252,7 @@ void SolverInterfaceImpl:: writeVectorData
   const double* value )
 {
   TRACE(fromDataID, valueIndex );
+  checkNotAdvancing("writeVectorData()");
 # ifndef NDEBUG
   if (_dimensions == 2) DEBUG("value = " << Eigen::Map<const Eigen::Vector2d>(value));
   if (_dimensions == 3) DEBUG("value = " << Eigen::Map<const Eigen::Vector3d>(value));
@@ -1204,6 +1288,7 @@ void SolverInterfaceImpl:: writeBlockScalarData
   double* values )
 {
   TRACE(fromDataID, size);
+  checkNotAdvancing("writeBlockScalarData()");
   if (size == 0)
     return;
   assertion(valueIndices != nullptr);
@@ -1231,6 +1316,7 @@ void SolverInterfaceImpl:: writeScalarData
   double value )
 {
   TRACE(fromDataID, valueIndex, value );
+  checkNotAdvancing("writeScalarData()");
   CHECK(valueIndex >= -1, "Invalid value index (" << valueIndex << ") when writing scalar data!");
   if (_clientMode){
     _requestManager->requestWriteScalarData(fromDataID, valueIndex, value);
@@ -1255,6 +1341,7 @@ void SolverInterfaceImpl:: readBlockVectorData
   double* values )
 {
   TRACE(toDataID, size);
+  checkNotAdvancing("readBlockVectorData()");
   if (size == 0)
     return;
   assertion(valueIndices != nullptr);
@@ -1287,6 +1374,7 @@ void SolverInterfaceImpl:: readVectorData
   double* value )
 {
   TRACE(toDataID, valueIndex);
+  checkNotAdvancing("readVectorData()");
   CHECK(valueIndex >= -1, "Invalid value index ( " << valueIndex << " )when reading vector data!");
   if (_clientMode){
     _requestManager->requestReadVectorData(toDataID, valueIndex, value);
@@ -1318,6 +1406,7 @@ void SolverInterfaceImpl:: readBlockScalarData
   double* values )
 {
   TRACE(toDataID, size);
+  checkNotAdvancing("readBlockScalarData()");
   if (size == 0)
     return;
   DEBUG("size = " << size);
@@ -1347,6 +1436,7 @@ void SolverInterfaceImpl:: readScalarData
   double& value )
 {
   TRACE(toDataID, valueIndex, value);
+  checkNotAdvancing("readScalarData()");
   CHECK(valueIndex >= -1, "Invalid value index ( " << valueIndex << " )when reading vector data!");
   if (_clientMode){
     _requestManager->requestReadScalarData(toDataID, valueIndex, value);
@@ -1364,6 +1454,16 @@ void SolverInterfaceImpl:: readScalarData
 }
 
 void SolverInterfaceImpl:: exportMesh
+(
+  const std::string& filenameSuffix,
+  int                exportType )
+{
+  TRACE(filenameSuffix, exportType );
+  checkNotAdvancing("exportMesh()");
+  performExport(filenameSuffix, exportType);
+}
+
+void SolverInterfaceImpl:: performExport
 (
   const std::string& filenameSuffix,
   int                exportType )
@@ -1391,6 +1491,7 @@ MeshHandle SolverInterfaceImpl:: getMeshHandle
   const std::string& meshName )
 {
   TRACE(meshName);
+  checkNotAdvancing("getMeshHandle()");
   assertion(not _clientMode);
   for (MeshContext* context : _accessor->usedMeshContexts()){
     if (context->mesh->getName() == meshName){
@@ -1403,6 +1504,7 @@ MeshHandle SolverInterfaceImpl:: getMeshHandle
 
 void SolverInterfaceImpl:: runServer()
 {
+  checkNotAdvancing("runServer()");
   assertion(_serverMode);
   initializeClientServerCommunication();
   _requestManager->handleRequests();
@@ -1687,11 +1789,11 @@ void SolverInterfaceImpl:: handleExports()
           if (context.everyIteration){
             std::ostringstream everySuffix;
             everySuffix << _accessorName << ".it" << _numberAdvanceCalls;
-            exportMesh(everySuffix.str());
+            performExport(everySuffix.str(), constants::exportAll());
           }
           std::ostringstream suffix;
           suffix << _accessorName << ".dt" << _couplingScheme->getTimesteps()-1;
-          exportMesh(suffix.str());
+          performExport(suffix.str(), constants::exportAll());
           if (context.triggerSolverPlot){
             _couplingScheme->requireAction(constants::actionPlotOutput());
           }
@@ -1769,6 +1871,22 @@ void SolverInterfaceImpl:: initializeMasterSlaveCommunication()
     utils::MasterSlave::_communication->requestConnection( _accessorName + "Master", _accessorName,
                             _accessorProcessRank-rankOffset, _accessorCommunicatorSize-rankOffset );
   }
+
+  // Without native collectives, reductions and broadcasts are passed along a binomial tree
+  com::PtrCommunicationFactory treeFactory = _accessor->getMasterSlaveTreeFactory();
+  if ( treeFactory ){
+    utils::MasterSlave::_communication->connectTree ( *treeFactory, _accessorName + "Tree",
+                            _accessorProcessRank, _accessorCommunicatorSize );
+  }
+  // further connections between the ranks, e.g. the ring of the IMVJ post-processing, are set up on demand
+  utils::MasterSlave::_communicationFactory = treeFactory;
+}
+
+void SolverInterfaceImpl:: checkNotAdvancing
+(
+  const std::string& method ) const
+{
+  CHECK(not _isAdvancing, method << " must not be called between startAdvance() and finishAdvance()");
 }
 
 void SolverInterfaceImpl:: syncTimestep(double computedTimestepLength)
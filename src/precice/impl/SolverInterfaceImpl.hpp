@@ -14,6 +14,7 @@
 #include <string>
 #include <vector>
 #include <set>
+#include <thread>
 
 namespace precice {
   namespace impl {
@@ -115,6 +116,22 @@ public:
    */
   double advance ( double computedTimestepLength );
 
+  /**
+   * @brief Starts advance() on a progress thread and returns immediately.
+   *
+   * All other public methods stop with an error until finishAdvance() has been called.
+   *
+   * @param computedTimestepLength [IN] Length of timestep computed by solver.
+   */
+  void startAdvance ( double computedTimestepLength );
+
+  /**
+   * @brief Waits for the advance started by startAdvance() to complete.
+   *
+   * @return Maximum length of next timestep to be computed by solver.
+   */
+  double finishAdvance();
+
   /**
    * @brief Finalizes the coupled simulation.
    *
@@ -540,6 +557,15 @@ private:
   // @brief Counts calls to advance for plotting.
   long int _numberAdvanceCalls;
 
+  // @brief Progress thread running advance between startAdvance and finishAdvance.
+  std::thread _advanceThread;
+
+  // @brief True between calls of startAdvance and finishAdvance.
+  bool _isAdvancing;
+
+  // @brief Return value of the advance run by the progress thread.
+  double _advanceResult;
+
 //  // @brief Locks the next receive operation of the server to a specific client.
 //  int _lockServerToClient;
 
@@ -646,6 +672,27 @@ private:
    */
   void initializeMasterSlaveCommunication();
 
+  /**
+   * @brief Exchanges coupling data and advances coupling state, see advance().
+   *
+   * Is run by the progress thread for startAdvance().
+   */
+  double performAdvance(double computedTimestepLength);
+
+  /**
+   * @brief Writes all used meshes to file, see exportMesh().
+   *
+   * Is used internally, also by the progress thread for startAdvance().
+   */
+  void performExport(const std::string& filenameSuffix, int exportType);
+
+  /**
+   * @brief Checks that no advance started by startAdvance() is pending.
+   *
+   * @param[in] method Name of the called method for the error message.
+   */
+  void checkNotAdvancing(const std::string& method) const;
+
   /**
    * @brief syncs the timestep between slaves and master (all timesteps should be the same!)
    */
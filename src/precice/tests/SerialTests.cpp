@@ -291,6 +291,184 @@ BOOST_AUTO_TEST_CASE(testExplicitWithDataExchange,
   }
 }
 
+/**
+ * @brief Both solvers advance asynchronously in an explicit coupling.
+ *
+ * SolverOne overwrites its write buffer between startAdvance() and finishAdvance(), which is allowed, as
+ * preCICE copies written values. SolverTwo has to receive the values written before startAdvance().
+ */
+BOOST_AUTO_TEST_CASE(testExplicitWithAsyncAdvance,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::MPICommRestrictFixture>(std::vector<int>({0, 1})))
+{
+  if (utils::Parallel::getCommunicatorSize() != 2)
+    return;
+
+  int timesteps = 0;
+  using Eigen::Vector3d;
+
+  if (utils::Parallel::getProcessRank() == 0){
+    SolverInterface cplInterface("SolverOne", 0, 1);
+    config::Configuration config;
+    xml::configure(config.getXMLTag(), _pathToTests + "explicit-sockets.xml");
+    cplInterface._impl->configure(config.getSolverInterfaceConfiguration());
+    int meshOneID = cplInterface.getMeshID("MeshOne");
+    int forcesID = cplInterface.getDataID("Forces", cplInterface.getMeshID("Test-Square"));
+    cplInterface.setMeshVertex(meshOneID, Vector3d::Zero().eval().data());
+    double maxDt = cplInterface.initialize();
+
+    std::vector<int> vertexIDs;
+    for (VertexIterator it : cplInterface.getMeshHandle("Test-Square").vertices()){
+      vertexIDs.push_back(it.vertexID());
+    }
+    std::vector<double> forces(3 * vertexIDs.size());
+    while (cplInterface.isCouplingOngoing()){
+      std::fill(forces.begin(), forces.end(), timesteps);
+      cplInterface.writeBlockVectorData(forcesID, vertexIDs.size(), vertexIDs.data(), forces.data());
+      cplInterface.startAdvance(maxDt);
+      // the solver may reuse its buffer while preCICE advances
+      std::fill(forces.begin(), forces.end(), -1.0);
+      maxDt = cplInterface.finishAdvance();
+      timesteps++;
+    }
+    cplInterface.finalize();
+  }
+  else if (utils::Parallel::getProcessRank() == 1){
+    SolverInterface cplInterface("SolverTwo", 0, 1);
+    config::Configuration config;
+    xml::configure(config.getXMLTag(), _pathToTests + "explicit-sockets.xml");
+    cplInterface._impl->configure(config.getSolverInterfaceConfiguration());
+    int meshID = cplInterface.getMeshID("Test-Square");
+    int vertexIDs[4];
+    vertexIDs[0] = cplInterface.setMeshVertex(meshID, Vector3d(0.0,0.0,0.0).data());
+    vertexIDs[1] = cplInterface.setMeshVertex(meshID, Vector3d(1.0,0.0,0.0).data());
+    vertexIDs[2] = cplInterface.setMeshVertex(meshID, Vector3d(0.0,1.0,0.0).data());
+    vertexIDs[3] = cplInterface.setMeshVertex(meshID, Vector3d(1.0,1.0,0.0).data());
+    int forcesID = cplInterface.getDataID("Forces", meshID);
+    double maxDt = cplInterface.initialize();
+
+    while (cplInterface.isCouplingOngoing()){
+      Eigen::VectorXd forces(12);
+      cplInterface.readBlockVectorData(forcesID, 4, vertexIDs, forces.data());
+      BOOST_TEST(forces == Eigen::VectorXd::Constant(12, timesteps));
+      cplInterface.startAdvance(maxDt);
+      maxDt = cplInterface.finishAdvance();
+      timesteps++;
+    }
+    cplInterface.finalize();
+  }
+  BOOST_TEST(timesteps == 10);
+}
+
+/**
+ * @brief The first solver advances asynchronously in an implicit coupling.
+ *
+ * Forces encode the time step and iteration of SolverOne, such that SolverTwo can check that it receives
+ * the values written before startAdvance(), although SolverOne overwrites its buffer right afterwards.
+ * The velocities of SolverTwo decrease with the iterations, such that every time step needs several
+ * iterations, and SolverOne checks that they are available after finishAdvance().
+ */
+BOOST_AUTO_TEST_CASE(testImplicitWithAsyncAdvance,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::MPICommRestrictFixture>(std::vector<int>({0, 1})))
+{
+  if (utils::Parallel::getCommunicatorSize() != 2)
+    return;
+
+  int timestep = 0;
+  int iteration = 0;
+  int totalIterations = 0;
+  int computedTimesteps = 0;
+  using namespace precice::constants;
+
+  if (utils::Parallel::getProcessRank() == 0){
+    SolverInterface couplingInterface("SolverOne", 0, 1);
+    config::Configuration config;
+    xml::configure(config.getXMLTag(), _pathToTests + "implicit.xml");
+    couplingInterface._impl->configure(config.getSolverInterfaceConfiguration());
+
+    int meshID = couplingInterface.getMeshID("Square");
+    int forcesID = couplingInterface.getDataID("Forces", meshID);
+    int velocitiesID = couplingInterface.getDataID("Velocities", meshID);
+    int vertexIDs[4];
+    vertexIDs[0] = couplingInterface.setMeshVertex(meshID, Eigen::Vector3d(0.0, 0.0, 0.0).data());
+    vertexIDs[1] = couplingInterface.setMeshVertex(meshID, Eigen::Vector3d(1.0, 0.0, 0.0).data());
+    vertexIDs[2] = couplingInterface.setMeshVertex(meshID, Eigen::Vector3d(1.0, 1.0, 0.0).data());
+    vertexIDs[3] = couplingInterface.setMeshVertex(meshID, Eigen::Vector3d(0.0, 1.0, 0.0).data());
+
+    double maxDt = couplingInterface.initialize();
+    Eigen::VectorXd forces(12);
+    while (couplingInterface.isCouplingOngoing()){
+      if (couplingInterface.isActionRequired(actionWriteIterationCheckpoint())){
+        couplingInterface.fulfilledAction(actionWriteIterationCheckpoint());
+        timestep++;
+        iteration = 1;
+      }
+      if (couplingInterface.isActionRequired(actionReadIterationCheckpoint())){
+        couplingInterface.fulfilledAction(actionReadIterationCheckpoint());
+        iteration++;
+      }
+      forces.setConstant(10.0 * timestep + iteration);
+      couplingInterface.writeBlockVectorData(forcesID, 4, vertexIDs, forces.data());
+      couplingInterface.startAdvance(maxDt);
+      // the solver may reuse its buffer while preCICE advances
+      forces.setConstant(-1.0);
+      maxDt = couplingInterface.finishAdvance();
+      totalIterations++;
+      if (couplingInterface.isCouplingOngoing()){
+        Eigen::VectorXd velocities(12);
+        couplingInterface.readBlockVectorData(velocitiesID, 4, vertexIDs, velocities.data());
+        BOOST_TEST(testing::equals(velocities, Eigen::VectorXd::Constant(12, 10.0 / iteration)));
+      }
+      if (couplingInterface.isTimestepComplete()){
+        computedTimesteps++;
+      }
+    }
+    couplingInterface.finalize();
+  }
+  else if (utils::Parallel::getProcessRank() == 1){
+    SolverInterface couplingInterface("SolverTwo", 0, 1);
+    config::Configuration config;
+    xml::configure(config.getXMLTag(), _pathToTests + "implicit.xml");
+    couplingInterface._impl->configure(config.getSolverInterfaceConfiguration());
+    int meshID = couplingInterface.getMeshID("Square");
+    int forcesID = couplingInterface.getDataID("Forces", meshID);
+    int velocitiesID = couplingInterface.getDataID("Velocities", meshID);
+    double maxDt = couplingInterface.initialize();
+
+    std::vector<int> vertexIDs;
+    for (VertexIterator it : couplingInterface.getMeshHandle("Square").vertices()){
+      vertexIDs.push_back(it.vertexID());
+    }
+    BOOST_TEST(vertexIDs.size() == 4);
+    while (couplingInterface.isCouplingOngoing()){
+      if (couplingInterface.isActionRequired(actionWriteIterationCheckpoint())){
+        couplingInterface.fulfilledAction(actionWriteIterationCheckpoint());
+        timestep++;
+        iteration = 1;
+      }
+      if (couplingInterface.isActionRequired(actionReadIterationCheckpoint())){
+        couplingInterface.fulfilledAction(actionReadIterationCheckpoint());
+        iteration++;
+      }
+      Eigen::VectorXd forces(12);
+      couplingInterface.readBlockVectorData(forcesID, 4, vertexIDs.data(), forces.data());
+      BOOST_TEST(forces == Eigen::VectorXd::Constant(12, 10.0 * timestep + iteration));
+      Eigen::VectorXd velocities = Eigen::VectorXd::Constant(12, 10.0 / iteration);
+      couplingInterface.writeBlockVectorData(velocitiesID, 4, vertexIDs.data(), velocities.data());
+      maxDt = couplingInterface.advance(maxDt);
+      totalIterations++;
+      if (couplingInterface.isTimestepComplete()){
+        computedTimesteps++;
+      }
+    }
+    couplingInterface.finalize();
+  }
+  BOOST_TEST(computedTimesteps == 4);
+  // the decreasing velocities need several iterations per time step
+  BOOST_TEST(totalIterations > 2 * computedTimesteps);
+}
+
 /**
  * @brief The second solver initializes the data of the first.
  *
@@ -18,6 +18,7 @@ int MasterSlave::_masterRank = 0;
 bool MasterSlave::_masterMode = false;
 bool MasterSlave::_slaveMode = false;
 com::PtrCommunication MasterSlave::_communication;
+com::PtrCommunicationFactory MasterSlave::_communicationFactory;
 
 
 logging::Logger MasterSlave:: _log("utils::MasterSlave" );
@@ -34,7 +35,7 @@ void MasterSlave:: configure(int rank, int size)
   DEBUG("slaveMode: " << _slaveMode <<", masterMode: " << _masterMode);
 }
 
-double MasterSlave:: l2norm(const Eigen::VectorXd& vec)
+double MasterSlave:: l2norm(const Eigen::Ref<const Eigen::VectorXd>& vec)
 {
   TRACE();
 
@@ -73,7 +74,7 @@ double MasterSlave:: l2norm(const Eigen::VectorXd& vec)
 }
 
 
-double MasterSlave:: dot(const Eigen::VectorXd& vec1, const Eigen::VectorXd& vec2)
+double MasterSlave:: dot(const Eigen::Ref<const Eigen::VectorXd>& vec1, const Eigen::Ref<const Eigen::VectorXd>& vec2)
 {
   TRACE();
 
@@ -29,14 +29,17 @@ public:
   /// Communication between the master and all slaves.
   static com::PtrCommunication _communication;
 
+  /// Creates further connections between the ranks, e.g. for Communication::connectRing(), nullptr if not available.
+  static com::PtrCommunicationFactory _communicationFactory;
+
   /// Configures the master-slave communication.
   static void configure(int rank, int size);
 
   /// The l2 norm of a vector is calculated on distributed data.
-  static double l2norm(const Eigen::VectorXd& vec);
+  static double l2norm(const Eigen::Ref<const Eigen::VectorXd>& vec);
 
   // The dot product of 2 vectors is calculated on distributed data.
-  static double dot(const Eigen::VectorXd& vec1, const Eigen::VectorXd& vec2);
+  static double dot(const Eigen::Ref<const Eigen::VectorXd>& vec1, const Eigen::Ref<const Eigen::VectorXd>& vec2);
 
   static void reset();
 
@@ -40,7 +40,8 @@ void Parallel::initializeMPI(
   if (not isMPIInitialized) {
     DEBUG("Initialize MPI");
     _mpiInitializedByPrecice = true;
-    MPI_Init(argc, argv);
+    int provided = MPI_THREAD_SINGLE;
+    MPI_Init_thread(argc, argv, MPI_THREAD_SERIALIZED, &provided);
   }
   _isInitialized = true;
 #endif // not PRECICE_NO_MPI
@@ -159,6 +160,17 @@ void Parallel::finalizeMPI()
   _isInitialized = false;
 }
 
+bool Parallel::isThreadSerialized()
+{
+#ifndef PRECICE_NO_MPI
+  int provided = MPI_THREAD_SINGLE;
+  MPI_Query_thread(&provided);
+  return provided >= MPI_THREAD_SERIALIZED;
+#else
+  return true;
+#endif // not PRECICE_NO_MPI
+}
+
 void Parallel::clearGroups()
 {
   _accessorGroups.clear();
@@ -51,8 +51,11 @@ public:
   /**
    * @brief Initializes the MPI environment.
    *
+   * MPI is initialized with MPI_THREAD_SERIALIZED, such that the progress thread of
+   * SolverInterface::startAdvance() may communicate.
+   *
    * @param[in] argc Parameter count
-   * @param[in] argc Parameter values, is passed to MPI_Init
+   * @param[in] argc Parameter values, is passed to MPI_Init_thread
    */
   static void initializeMPI(
       int *argc,
@@ -61,6 +64,9 @@ public:
   /// Finalizes MPI environment.
   static void finalizeMPI();
 
+  /// Returns true, if MPI calls from different threads are allowed, one at a time.
+  static bool isThreadSerialized();
+
   /// clears groups for communicator splitting
   static void clearGroups();
 
@@ -4,8 +4,12 @@
 
 #include <boost/filesystem.hpp>
 
+#include <algorithm>
 #include <fstream>
+#include <map>
 #include <sstream>
+#include <thread>
+#include <unordered_set>
 
 namespace precice
 {
@@ -121,6 +125,45 @@ std::string const & Publisher::eventNamePrefix()
   return _prefix;
 }
 
+void Publisher::waitForFiles(std::vector<std::string> const &fps)
+{
+  using boost::filesystem::path;
+
+  // Names of missing files, grouped by their parent directories.
+  std::map<std::string, std::vector<std::string>> missing;
+
+  for (auto const &fp : fps) {
+    path p(fp);
+    missing[p.has_parent_path() ? p.parent_path().string() : "."].push_back(p.filename().string());
+  }
+
+  std::chrono::milliseconds delay(1);
+
+  while (true) {
+    for (auto i = missing.begin(); i != missing.end();) {
+      std::unordered_set<std::string> present;
+      boost::system::error_code       ec;
+
+      for (boost::filesystem::directory_iterator entry(i->first, ec), end; not ec && entry != end; entry.increment(ec)) {
+        present.insert(entry->path().filename().string());
+      }
+
+      auto &names = i->second;
+      names.erase(std::remove_if(names.begin(), names.end(),
+                                 [&present](std::string const &name) { return present.count(name) > 0; }),
+                  names.end());
+
+      i = names.empty() ? missing.erase(i) : std::next(i);
+    }
+
+    if (missing.empty())
+      return;
+
+    std::this_thread::sleep_for(delay);
+    delay = std::min(2 * delay, std::chrono::milliseconds(100));
+  }
+}
+
 Publisher::Publisher(std::string const &fp)
     : _fp(buildFilePath(fp))
 {
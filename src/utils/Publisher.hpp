@@ -2,6 +2,7 @@
 
 #include <stack>
 #include <string>
+#include <vector>
 
 namespace precice
 {
@@ -66,6 +67,14 @@ public:
 
   static std::string const &eventNamePrefix();
 
+  /**
+   * @brief Blocks until all given files exist.
+   *
+   * Instead of probing each file separately, each parent directory is listed
+   * once per attempt, with increasing delays between attempts.
+   */
+  static void waitForFiles(std::vector<std::string> const &fps);
+
 public:
   explicit Publisher(std::string const &fp);
 
@@ -0,0 +1,133 @@
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include "logging/LogMacros.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice
+{
+namespace utils
+{
+
+logging::Logger ThreadPool::_log("utils::ThreadPool");
+
+ThreadPool &ThreadPool::getInstance()
+{
+  static ThreadPool instance;
+  return instance;
+}
+
+ThreadPool::ThreadPool()
+    : _workers(),
+      _minChunkSize(8192),
+      _function(nullptr),
+      _rangeSize(0),
+      _chunks(0),
+      _pending(0),
+      _generation(0),
+      _stop(false)
+{
+}
+
+ThreadPool::~ThreadPool()
+{
+  stop();
+}
+
+void ThreadPool::setSize(
+    int size)
+{
+  TRACE(size);
+  CHECK(size > 0, "The number of threads has to be positive!");
+  stop();
+  // the workers wait for jobs posted after this point, even if they start up late
+  unsigned int generation = _generation;
+  for (int chunk = 1; chunk < size; chunk++) {
+    _workers.emplace_back([this, chunk, generation]() { work(chunk, generation); });
+  }
+}
+
+void ThreadPool::setMinChunkSize(
+    int minChunkSize)
+{
+  assertion(minChunkSize > 0, minChunkSize);
+  _minChunkSize = minChunkSize;
+}
+
+void ThreadPool::parallelFor(
+    int                                     size,
+    const std::function<void(int, int)> &function,
+    int                                     costPerIndex)
+{
+  assertion(costPerIndex > 0, costPerIndex);
+  long long work   = static_cast<long long>(size) * costPerIndex;
+  int       chunks = static_cast<int>(std::min<long long>({getSize(), size, work / _minChunkSize}));
+  if (chunks <= 1) {
+    if (size > 0)
+      function(0, size);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    assertion(_function == nullptr);
+    _function  = &function;
+    _rangeSize = size;
+    _chunks    = chunks;
+    _pending   = chunks - 1;
+    _generation++;
+  }
+  _start.notify_all();
+
+  function(0, chunkBegin(1));
+
+  std::unique_lock<std::mutex> lock(_mutex);
+  _done.wait(lock, [this]() { return _pending == 0; });
+  _function = nullptr;
+}
+
+void ThreadPool::work(
+    int          chunk,
+    unsigned int generation)
+{
+  while (true) {
+    const std::function<void(int, int)> *function = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _start.wait(lock, [this, generation]() { return _stop || _generation != generation; });
+      if (_stop)
+        return;
+      generation = _generation;
+      if (chunk < _chunks)
+        function = _function;
+    }
+    if (function != nullptr) {
+      (*function)(chunkBegin(chunk), chunkBegin(chunk + 1));
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (--_pending == 0)
+        _done.notify_one();
+    }
+  }
+}
+
+void ThreadPool::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _start.notify_all();
+  for (auto &worker : _workers) {
+    worker.join();
+  }
+  _workers.clear();
+  _stop = false;
+}
+
+int ThreadPool::chunkBegin(
+    int chunk) const
+{
+  // _rangeSize and _chunks are not modified while a job is processed
+  return static_cast<long long>(_rangeSize) * chunk / _chunks;
+}
+}
+} // namespace precice, utils
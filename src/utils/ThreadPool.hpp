@@ -0,0 +1,99 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "logging/Logger.hpp"
+
+namespace precice
+{
+namespace utils
+{
+
+/**
+ * @brief Intra-process pool of worker threads for element-wise kernels on large vectors.
+ *
+ * The pool is shared by all kernels of a participant and its size is configured once, see
+ * impl::Participant::getThreadCount(). parallelFor() splits an index range into contiguous chunks,
+ * one per thread, and blocks until all chunks are processed. The calling thread processes the
+ * first chunk itself, i.e., a pool of size 1 has no worker threads and runs everything serially.
+ *
+ * parallelFor() must not be called concurrently or from within a kernel.
+ */
+class ThreadPool
+{
+public:
+  /// Returns the pool shared by all kernels.
+  static ThreadPool &getInstance();
+
+  /// Stops all worker threads.
+  ~ThreadPool();
+
+  /// Sets the number of threads including the calling thread, restarts the worker threads.
+  void setSize(int size);
+
+  /// Returns the number of threads including the calling thread.
+  int getSize() const
+  {
+    return _workers.size() + 1;
+  }
+
+  /// Sets the minimal number of indices per thread, smaller ranges are processed by fewer threads.
+  void setMinChunkSize(int minChunkSize);
+
+  /**
+   * @brief Calls function(begin, end) for disjoint chunks [begin, end) covering [0, size).
+   *
+   * The chunks are processed in parallel, the function must not write to shared data outside
+   * of its chunk. The minimal chunk size is measured in units of costPerIndex, e.g., the
+   * number of columns for kernels processing whole matrix rows.
+   */
+  void parallelFor(int size, const std::function<void(int, int)> &function, int costPerIndex = 1);
+
+private:
+  static logging::Logger _log;
+
+  ThreadPool();
+
+  /// Main loop of the worker thread processing the chunk with the given index of all jobs after the given generation.
+  void work(int chunk, unsigned int generation);
+
+  /// Joins all worker threads.
+  void stop();
+
+  /// Returns the first index of the given chunk of the current job.
+  int chunkBegin(int chunk) const;
+
+  std::vector<std::thread> _workers;
+
+  int _minChunkSize;
+
+  std::mutex _mutex;
+
+  /// Signals a new job or stopping to the worker threads.
+  std::condition_variable _start;
+
+  /// Signals the completion of all chunks of the current job to the calling thread.
+  std::condition_variable _done;
+
+  /// Kernel of the current job.
+  const std::function<void(int, int)> *_function;
+
+  /// Size of the index range of the current job.
+  int _rangeSize;
+
+  /// Number of chunks of the current job.
+  int _chunks;
+
+  /// Number of chunks of the current job not yet processed by the worker threads.
+  int _pending;
+
+  /// Incremented for every job, lets the worker threads detect new jobs.
+  unsigned int _generation;
+
+  bool _stop;
+};
+}
+} // namespace precice, utils
@@ -0,0 +1,54 @@
+#include <vector>
+#include "testing/Testing.hpp"
+#include "utils/ThreadPool.hpp"
+
+using namespace precice::utils;
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+
+BOOST_AUTO_TEST_CASE(ThreadPoolParallelFor)
+{
+  ThreadPool &pool = ThreadPool::getInstance();
+  pool.setSize(3);
+  pool.setMinChunkSize(4);
+  BOOST_TEST(pool.getSize() == 3);
+
+  // every index is visited exactly once, for ranges smaller and larger than the pool
+  for (int size : {0, 1, 5, 11, 12, 1000}) {
+    std::vector<int> visits(size, 0);
+    for (int repetition = 0; repetition < 20; repetition++) {
+      pool.parallelFor(size, [&visits](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+          visits[i]++;
+        }
+      });
+    }
+    BOOST_TEST(visits == std::vector<int>(size, 20), boost::test_tools::per_element());
+  }
+
+  // the chunks are processed by different threads
+  std::vector<std::thread::id> ids(1000);
+  pool.parallelFor(1000, [&ids](int begin, int end) {
+    for (int i = begin; i < end; i++) {
+      ids[i] = std::this_thread::get_id();
+    }
+  });
+  BOOST_TEST(ids.front() == std::this_thread::get_id());
+  BOOST_TEST(ids.back() != std::this_thread::get_id());
+
+  // expensive indices are distributed even if the range is smaller than the minimal chunk size
+  std::vector<std::thread::id> rowIds(2);
+  pool.parallelFor(2, [&rowIds](int begin, int end) {
+    for (int i = begin; i < end; i++) {
+      rowIds[i] = std::this_thread::get_id();
+    }
+  }, 4);
+  BOOST_TEST(rowIds[0] == std::this_thread::get_id());
+  BOOST_TEST(rowIds[1] != std::this_thread::get_id());
+
+  pool.setSize(1);
+  pool.setMinChunkSize(8192);
+  BOOST_TEST(pool.getSize() == 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()